@@ -0,0 +1,793 @@
+/*
+ * archive.c: Virtual Machine Placement Problem - Pareto Archive
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include archive header */
+#include "archive.h"
+#include "pareto.h"
+
+/* node of the ND-tree: a leaf holds elements, an internal node holds children,
+ * ideal and nadir bound every key below the node (they may be loose after removals) */
+struct nd_node
+{
+	float ideal[NUMBER_OF_OBJECTIVES];
+	float nadir[NUMBER_OF_OBJECTIVES];
+	int number_of_children;
+	struct nd_node *children[ND_TREE_CHILDREN];
+	int number_of_elements;
+	struct pareto_element *elements[ND_TREE_LEAF_SIZE + 1];
+};
+
+/* static function headers definitions */
+static void archive_evict(struct archive *archive, struct pareto_element *element);
+
+/* splitmix64: mixes a 64 bits value, used as an implicit Zobrist table
+ * parameter: value
+ * returns: mixed value
+ */
+static unsigned long long splitmix64(unsigned long long value)
+{
+	value += 0x9E3779B97F4A7C15ULL;
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+/* archive_hash: Zobrist hash of a solution, the XOR of a random word per (virtual machine, physical position)
+ * parameter: solution
+ * parameter: number of virtual machines
+ * returns: hash of the solution, a single move changes it by two XOR
+ */
+unsigned long long archive_hash(int *individual, int v_size)
+{
+	unsigned long long hash = 0;
+	/* iterator */
+	int iterator_virtual;
+	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	{
+		hash ^= splitmix64(((unsigned long long) iterator_virtual << 32) | (unsigned int) individual[iterator_virtual]);
+	}
+	return hash;
+}
+
+/* weakly_dominates: checks if a key is no worse than another one in every objective
+ * parameter: key a
+ * parameter: key b
+ * returns: 1 if a is no worse than b in every objective, 0 otherwise
+ */
+static int weakly_dominates(const float *key_a, const float *key_b)
+{
+	/* iterator */
+	int iterator_objective;
+	int worse = 0;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		worse |= key_a[iterator_objective] > key_b[iterator_objective];
+	}
+	return !worse;
+}
+
+/* nd_node_clear: turns a node into an empty leaf, without releasing anything
+ * parameter: node
+ * returns: nothing, it's void
+ */
+static void nd_node_clear(struct nd_node *node)
+{
+	/* iterator */
+	int iterator_objective;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		node->ideal[iterator_objective] = INFINITY;
+		node->nadir[iterator_objective] = -INFINITY;
+	}
+	node->number_of_children = 0;
+	node->number_of_elements = 0;
+}
+
+/* nd_node_create: creates an empty leaf of the ND-tree
+ * returns: leaf with empty bounds
+ */
+static struct nd_node * nd_node_create()
+{
+	struct nd_node *node = (struct nd_node *) malloc (sizeof (struct nd_node));
+	nd_node_clear(node);
+	return node;
+}
+
+/* nd_node_free: releases a subtree of the ND-tree, and its elements if asked to
+ * parameter: archive, to evict the elements
+ * parameter: node
+ * parameter: 1 to evict the elements of the subtree from the archive
+ * returns: nothing, it's void
+ */
+static void nd_node_free(struct archive *archive, struct nd_node *node, int evict)
+{
+	/* iterator */
+	int iterator_node;
+	for (iterator_node = 0; iterator_node < node->number_of_children; iterator_node++)
+	{
+		nd_node_free(archive, node->children[iterator_node], evict);
+	}
+	if (evict)
+	{
+		for (iterator_node = 0; iterator_node < node->number_of_elements; iterator_node++)
+		{
+			archive_evict(archive, node->elements[iterator_node]);
+		}
+	}
+	free(node);
+}
+
+/* nd_node_extend: extends the bounds of a node to hold a key
+ * parameter: node
+ * parameter: key
+ * returns: nothing, it's void
+ */
+static void nd_node_extend(struct nd_node *node, const float *key)
+{
+	/* iterator */
+	int iterator_objective;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		if (key[iterator_objective] < node->ideal[iterator_objective])
+		{
+			node->ideal[iterator_objective] = key[iterator_objective];
+		}
+		if (key[iterator_objective] > node->nadir[iterator_objective])
+		{
+			node->nadir[iterator_objective] = key[iterator_objective];
+		}
+	}
+}
+
+/* squared_distance: squared euclidean distance between two keys
+ * parameter: key a
+ * parameter: key b
+ * returns: squared distance
+ */
+static double squared_distance(const float *key_a, const float *key_b)
+{
+	/* iterator */
+	int iterator_objective;
+	double distance = 0.0;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		distance += ((double) key_a[iterator_objective] - key_b[iterator_objective]) * ((double) key_a[iterator_objective] - key_b[iterator_objective]);
+	}
+	return distance;
+}
+
+/* nd_node_split: turns an overfull leaf into an internal node, grouping its elements around distant seeds
+ * parameter: leaf
+ * returns: nothing, it's void
+ */
+static void nd_node_split(struct nd_node *node)
+{
+	/* iterators */
+	int iterator_element;
+	int iterator_seed;
+	int number_of_elements = node->number_of_elements;
+	int seeds[ND_TREE_CHILDREN];
+	int best_element = 0;
+	int best_seed;
+	double best_distance;
+	double distance;
+	/* distance of each element to its closest seed */
+	double closest[ND_TREE_LEAF_SIZE + 1];
+
+	/* first seed: the element farthest on average from the others */
+	best_distance = -1.0;
+	for (iterator_element = 0; iterator_element < number_of_elements; iterator_element++)
+	{
+		distance = 0.0;
+		for (iterator_seed = 0; iterator_seed < number_of_elements; iterator_seed++)
+		{
+			distance += sqrt(squared_distance(node->elements[iterator_element]->key, node->elements[iterator_seed]->key));
+		}
+		if (distance > best_distance)
+		{
+			best_distance = distance;
+			best_element = iterator_element;
+		}
+	}
+	seeds[0] = best_element;
+	for (iterator_element = 0; iterator_element < number_of_elements; iterator_element++)
+	{
+		closest[iterator_element] = squared_distance(node->elements[iterator_element]->key, node->elements[best_element]->key);
+	}
+	/* next seeds: the element farthest from the chosen seeds */
+	for (iterator_seed = 1; iterator_seed < ND_TREE_CHILDREN; iterator_seed++)
+	{
+		best_distance = -1.0;
+		for (iterator_element = 0; iterator_element < number_of_elements; iterator_element++)
+		{
+			if (closest[iterator_element] > best_distance)
+			{
+				best_distance = closest[iterator_element];
+				best_element = iterator_element;
+			}
+		}
+		seeds[iterator_seed] = best_element;
+		for (iterator_element = 0; iterator_element < number_of_elements; iterator_element++)
+		{
+			distance = squared_distance(node->elements[iterator_element]->key, node->elements[best_element]->key);
+			if (distance < closest[iterator_element])
+			{
+				closest[iterator_element] = distance;
+			}
+		}
+	}
+	/* every element goes to the child of its closest seed */
+	for (iterator_seed = 0; iterator_seed < ND_TREE_CHILDREN; iterator_seed++)
+	{
+		node->children[iterator_seed] = nd_node_create();
+	}
+	node->number_of_children = ND_TREE_CHILDREN;
+	for (iterator_element = 0; iterator_element < number_of_elements; iterator_element++)
+	{
+		best_seed = 0;
+		best_distance = INFINITY;
+		for (iterator_seed = 0; iterator_seed < ND_TREE_CHILDREN; iterator_seed++)
+		{
+			distance = squared_distance(node->elements[iterator_element]->key, node->elements[seeds[iterator_seed]]->key);
+			if (distance < best_distance)
+			{
+				best_distance = distance;
+				best_seed = iterator_seed;
+			}
+		}
+		node->children[best_seed]->elements[node->children[best_seed]->number_of_elements++] = node->elements[iterator_element];
+		nd_node_extend(node->children[best_seed], node->elements[iterator_element]->key);
+	}
+	node->number_of_elements = 0;
+}
+
+/* nd_node_insert: inserts an element below a node, following the child with the closest middle point
+ * parameter: node
+ * parameter: element
+ * returns: nothing, it's void
+ */
+static void nd_node_insert(struct nd_node *node, struct pareto_element *element)
+{
+	/* iterators */
+	int iterator_node;
+	int iterator_objective;
+	int best_child;
+	double best_distance;
+	double distance;
+	double middle;
+	while (node->number_of_children > 0)
+	{
+		nd_node_extend(node, element->key);
+		best_child = 0;
+		best_distance = INFINITY;
+		for (iterator_node = 0; iterator_node < node->number_of_children; iterator_node++)
+		{
+			distance = 0.0;
+			for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+			{
+				middle = ((double) node->children[iterator_node]->ideal[iterator_objective] + node->children[iterator_node]->nadir[iterator_objective]) / 2;
+				distance += (element->key[iterator_objective] - middle) * (element->key[iterator_objective] - middle);
+			}
+			if (distance < best_distance)
+			{
+				best_distance = distance;
+				best_child = iterator_node;
+			}
+		}
+		node = node->children[best_child];
+	}
+	nd_node_extend(node, element->key);
+	node->elements[node->number_of_elements++] = element;
+	if (node->number_of_elements > ND_TREE_LEAF_SIZE)
+	{
+		nd_node_split(node);
+	}
+}
+
+/* nd_node_update: rejects a key weakly dominated by the subtree, or evicts the elements of the subtree it dominates
+ * parameter: archive
+ * parameter: node
+ * parameter: key of the candidate
+ * returns: 1 if an element weakly dominates the candidate, 0 otherwise
+ */
+static int nd_node_update(struct archive *archive, struct nd_node *node, const float *key)
+{
+	/* iterators */
+	int iterator_node;
+	int iterator_objective;
+	int strictly_better;
+	/* the nadir of the node weakly dominates the key, so every element of the node does */
+	if (weakly_dominates(node->nadir, key))
+	{
+		return node->number_of_children > 0 || node->number_of_elements > 0;
+	}
+	/* the key is not comparable with any element of the node */
+	if (!weakly_dominates(key, node->nadir) && !weakly_dominates(node->ideal, key))
+	{
+		return 0;
+	}
+	/* the key dominates the ideal of the node, so it dominates every element of the node */
+	if (weakly_dominates(key, node->ideal))
+	{
+		strictly_better = 0;
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			strictly_better |= key[iterator_objective] < node->ideal[iterator_objective];
+		}
+		if (strictly_better)
+		{
+			for (iterator_node = 0; iterator_node < node->number_of_children; iterator_node++)
+			{
+				nd_node_free(archive, node->children[iterator_node], 1);
+			}
+			for (iterator_node = 0; iterator_node < node->number_of_elements; iterator_node++)
+			{
+				archive_evict(archive, node->elements[iterator_node]);
+			}
+			nd_node_clear(node);
+			return 0;
+		}
+	}
+	if (node->number_of_children == 0)
+	{
+		/* check every element of the leaf */
+		for (iterator_node = 0; iterator_node < node->number_of_elements; iterator_node++)
+		{
+			if (weakly_dominates(node->elements[iterator_node]->key, key))
+			{
+				return 1;
+			}
+			if (weakly_dominates(key, node->elements[iterator_node]->key))
+			{
+				archive_evict(archive, node->elements[iterator_node]);
+				node->elements[iterator_node--] = node->elements[--node->number_of_elements];
+			}
+		}
+		return 0;
+	}
+	/* check every child, dropping the ones left empty */
+	for (iterator_node = 0; iterator_node < node->number_of_children; iterator_node++)
+	{
+		if (nd_node_update(archive, node->children[iterator_node], key))
+		{
+			return 1;
+		}
+		if (node->children[iterator_node]->number_of_children == 0 && node->children[iterator_node]->number_of_elements == 0)
+		{
+			free(node->children[iterator_node]);
+			node->children[iterator_node--] = node->children[--node->number_of_children];
+		}
+	}
+	/* an internal node with a single child takes its place */
+	if (node->number_of_children == 1)
+	{
+		struct nd_node *child = node->children[0];
+		memcpy(node, child, sizeof (struct nd_node));
+		free(child);
+	}
+	return 0;
+}
+
+/* nd_node_dominated: checks if an element of the subtree weakly dominates a key
+ * parameter: node
+ * parameter: key
+ * returns: 1 if the key is weakly dominated, 0 otherwise
+ */
+static int nd_node_dominated(struct nd_node *node, const float *key)
+{
+	/* iterator */
+	int iterator_node;
+	if (!weakly_dominates(node->ideal, key))
+	{
+		return 0;
+	}
+	if (weakly_dominates(node->nadir, key))
+	{
+		return node->number_of_children > 0 || node->number_of_elements > 0;
+	}
+	for (iterator_node = 0; iterator_node < node->number_of_elements; iterator_node++)
+	{
+		if (weakly_dominates(node->elements[iterator_node]->key, key))
+		{
+			return 1;
+		}
+	}
+	for (iterator_node = 0; iterator_node < node->number_of_children; iterator_node++)
+	{
+		if (nd_node_dominated(node->children[iterator_node], key))
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* nd_node_remove: takes an element out of the subtree, without releasing it
+ * parameter: node
+ * parameter: element
+ * returns: 1 if the element was found below the node, 0 otherwise
+ */
+static int nd_node_remove(struct nd_node *node, struct pareto_element *element)
+{
+	/* iterator */
+	int iterator_node;
+	if (!weakly_dominates(node->ideal, element->key) || !weakly_dominates(element->key, node->nadir))
+	{
+		return 0;
+	}
+	for (iterator_node = 0; iterator_node < node->number_of_elements; iterator_node++)
+	{
+		if (node->elements[iterator_node] == element)
+		{
+			node->elements[iterator_node] = node->elements[--node->number_of_elements];
+			return 1;
+		}
+	}
+	for (iterator_node = 0; iterator_node < node->number_of_children; iterator_node++)
+	{
+		if (nd_node_remove(node->children[iterator_node], element))
+		{
+			/* drop the child left empty, an internal node with a single child takes its place */
+			if (node->children[iterator_node]->number_of_children == 0 && node->children[iterator_node]->number_of_elements == 0)
+			{
+				free(node->children[iterator_node]);
+				node->children[iterator_node] = node->children[--node->number_of_children];
+			}
+			if (node->number_of_children == 1)
+			{
+				struct nd_node *child = node->children[0];
+				memcpy(node, child, sizeof (struct nd_node));
+				free(child);
+			}
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* epsilon_grid_victim: chooses the member to remove with an epsilon-dominance grid,
+ * the one farthest from the corner of its box in the most crowded box
+ * parameter: normalized keys of the members
+ * parameter: number of members
+ * returns: index of the member to remove
+ */
+static int epsilon_grid_victim(const float *keys, int number_of_members)
+{
+	/* iterators */
+	int iterator_member;
+	int iterator_other;
+	int iterator_objective;
+	int victim = 0;
+	int box;
+	int same_box;
+	int occupancy;
+	int best_occupancy = 0;
+	double distance;
+	double best_distance = -1.0;
+	double offset;
+	for (iterator_member = 0; iterator_member < number_of_members; iterator_member++)
+	{
+		/* members sharing the box of the actual member */
+		occupancy = 0;
+		for (iterator_other = 0; iterator_other < number_of_members; iterator_other++)
+		{
+			same_box = 1;
+			for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES && same_box; iterator_objective++)
+			{
+				same_box = (int) (keys[iterator_member * NUMBER_OF_OBJECTIVES + iterator_objective] * ARCHIVE_GRID_DIVISIONS) ==
+					(int) (keys[iterator_other * NUMBER_OF_OBJECTIVES + iterator_objective] * ARCHIVE_GRID_DIVISIONS);
+			}
+			occupancy += same_box;
+		}
+		/* distance from the corner of the box, the lower the better */
+		distance = 0.0;
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			box = (int) (keys[iterator_member * NUMBER_OF_OBJECTIVES + iterator_objective] * ARCHIVE_GRID_DIVISIONS);
+			offset = keys[iterator_member * NUMBER_OF_OBJECTIVES + iterator_objective] - (double) box / ARCHIVE_GRID_DIVISIONS;
+			distance += offset * offset;
+		}
+		if (occupancy > best_occupancy || (occupancy == best_occupancy && distance > best_distance))
+		{
+			best_occupancy = occupancy;
+			best_distance = distance;
+			victim = iterator_member;
+		}
+	}
+	return victim;
+}
+
+/* archive_truncate: removes a member of an archive over its capacity with the truncation strategy of the archive
+ * parameter: archive
+ * returns: the removed member, already evicted
+ */
+static struct pareto_element * archive_truncate(struct archive *archive)
+{
+	/* iterators */
+	int iterator_member;
+	int iterator_objective;
+	int victim = 0;
+	int number_of_members = archive->size;
+	float minimum;
+	float maximum;
+	float reference[NUMBER_OF_OBJECTIVES];
+	struct pareto_element *element;
+	/* the archive is only truncated one member over its capacity */
+	struct pareto_element **members = archive->truncation_members;
+	float *keys = archive->truncation_keys;
+	double *measures = archive->truncation_measures;
+	for (element = archive->head, iterator_member = 0; element != NULL; element = element->next, iterator_member++)
+	{
+		members[iterator_member] = element;
+	}
+	/* keys normalized to [0, 1] by the bounds of the members, so every objective weighs the same */
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		minimum = INFINITY;
+		maximum = -INFINITY;
+		for (iterator_member = 0; iterator_member < number_of_members; iterator_member++)
+		{
+			minimum = fminf(minimum, members[iterator_member]->key[iterator_objective]);
+			maximum = fmaxf(maximum, members[iterator_member]->key[iterator_objective]);
+		}
+		for (iterator_member = 0; iterator_member < number_of_members; iterator_member++)
+		{
+			keys[iterator_member * NUMBER_OF_OBJECTIVES + iterator_objective] = maximum > minimum ?
+				(members[iterator_member]->key[iterator_objective] - minimum) / (maximum - minimum) : 0.0f;
+		}
+		reference[iterator_objective] = ARCHIVE_REFERENCE;
+	}
+	switch (archive->truncation)
+	{
+		case ARCHIVE_TRUNCATE_EPSILON:
+			victim = epsilon_grid_victim(keys, number_of_members);
+			break;
+		case ARCHIVE_TRUNCATE_CROWDING:
+		case ARCHIVE_TRUNCATE_HYPERVOLUME:
+			/* the member with the lowest crowding distance or hypervolume contribution */
+			if (archive->truncation == ARCHIVE_TRUNCATE_CROWDING)
+			{
+				crowding_distances(keys, number_of_members, measures, archive->truncation_order);
+			}
+			else
+			{
+				hypervolume_contributions(keys, number_of_members, reference, measures, archive->state, archive->truncation_scratch);
+			}
+			for (iterator_member = 1; iterator_member < number_of_members; iterator_member++)
+			{
+				if (measures[iterator_member] < measures[victim])
+				{
+					victim = iterator_member;
+				}
+			}
+			break;
+	}
+	element = members[victim];
+	nd_node_remove(archive->root, element);
+	archive_evict(archive, element);
+	return element;
+}
+
+/* archive_create: creates an empty archive
+ * parameter: number of virtual machines
+ * parameter: maximum number of members, ARCHIVE_UNBOUNDED for no limit
+ * parameter: truncation strategy, ARCHIVE_TRUNCATE_EPSILON, ARCHIVE_TRUNCATE_CROWDING or ARCHIVE_TRUNCATE_HYPERVOLUME
+ * returns: archive
+ */
+struct archive * archive_create(int v_size, int capacity, int truncation)
+{
+	struct archive *archive = (struct archive *) malloc (sizeof (struct archive));
+	archive->v_size = v_size;
+	archive->size = 0;
+	archive->head = NULL;
+	archive->number_of_buckets = ARCHIVE_INITIAL_BUCKETS;
+	archive->buckets = (struct pareto_element **) calloc (ARCHIVE_INITIAL_BUCKETS, sizeof (struct pareto_element *));
+	archive->root = nd_node_create();
+	archive->capacity = capacity;
+	archive->truncation = truncation;
+	archive->state[0] = 0x330E;
+	archive->state[1] = (unsigned short) v_size;
+	archive->state[2] = (unsigned short) capacity;
+	archive->spare = NULL;
+	archive->truncation_members = NULL;
+	archive->truncation_keys = NULL;
+	archive->truncation_measures = NULL;
+	archive->truncation_order = NULL;
+	archive->truncation_scratch = NULL;
+	if (capacity != ARCHIVE_UNBOUNDED)
+	{
+		archive->truncation_members = (struct pareto_element **) malloc ((capacity + 1) * sizeof (struct pareto_element *));
+		archive->truncation_keys = (float *) malloc ((size_t) (capacity + 1) * NUMBER_OF_OBJECTIVES * sizeof (float));
+		archive->truncation_measures = (double *) malloc ((capacity + 1) * sizeof (double));
+		archive->truncation_order = (int *) malloc ((capacity + 1) * sizeof (int));
+		archive->truncation_scratch = scratch_create(0);
+	}
+	return archive;
+}
+
+/* archive_free: releases an archive and its elements
+ * parameter: archive
+ * returns: nothing, it's void
+ */
+void archive_free(struct archive *archive)
+{
+	struct pareto_element *element;
+	if (archive != NULL)
+	{
+		nd_node_free(archive, archive->root, 1);
+		while (archive->spare != NULL)
+		{
+			element = archive->spare;
+			archive->spare = element->next;
+			free(element->solution);
+			free(element->costs);
+			free(element);
+		}
+		free(archive->truncation_members);
+		free(archive->truncation_keys);
+		free(archive->truncation_measures);
+		free(archive->truncation_order);
+		scratch_free(archive->truncation_scratch);
+		free(archive->buckets);
+		free(archive);
+	}
+}
+
+/* archive_evict: removes an element from the list and the hash table of the archive and keeps it as a spare one
+ * parameter: archive
+ * parameter: element
+ * returns: nothing, it's void
+ */
+static void archive_evict(struct archive *archive, struct pareto_element *element)
+{
+	struct pareto_element **bucket = &archive->buckets[element->hash & (archive->number_of_buckets - 1)];
+	while (*bucket != element)
+	{
+		bucket = &(*bucket)->hash_next;
+	}
+	*bucket = element->hash_next;
+	if (element->prev != NULL)
+	{
+		element->prev->next = element->next;
+	}
+	else
+	{
+		archive->head = element->next;
+	}
+	if (element->next != NULL)
+	{
+		element->next->prev = element->prev;
+	}
+	archive->size--;
+	element->next = archive->spare;
+	archive->spare = element;
+}
+
+/* archive_rehash: doubles the number of buckets of the hash table
+ * parameter: archive
+ * returns: nothing, it's void
+ */
+static void archive_rehash(struct archive *archive)
+{
+	struct pareto_element *element;
+	struct pareto_element **buckets = (struct pareto_element **) calloc (archive->number_of_buckets * 2, sizeof (struct pareto_element *));
+	archive->number_of_buckets *= 2;
+	for (element = archive->head; element != NULL; element = element->next)
+	{
+		element->hash_next = buckets[element->hash & (archive->number_of_buckets - 1)];
+		buckets[element->hash & (archive->number_of_buckets - 1)] = element;
+	}
+	free(archive->buckets);
+	archive->buckets = buckets;
+}
+
+/* find_solution: searches a solution in the hash table
+ * parameter: archive
+ * parameter: solution
+ * parameter: hash of the solution
+ * returns: element holding the solution, NULL if it is not in the archive
+ */
+static struct pareto_element * find_solution(struct archive *archive, int *individual, unsigned long long hash)
+{
+	struct pareto_element *element = archive->buckets[hash & (archive->number_of_buckets - 1)];
+	for (; element != NULL; element = element->hash_next)
+	{
+		if (element->hash == hash && memcmp(element->solution, individual, archive->v_size * sizeof (int)) == 0)
+		{
+			return element;
+		}
+	}
+	return NULL;
+}
+
+/* archive_contains: checks if a solution is in the archive
+ * parameter: archive
+ * parameter: solution
+ * returns: 1 if the solution is in the archive, 0 otherwise
+ */
+int archive_contains(struct archive *archive, int *individual)
+{
+	return find_solution(archive, individual, archive_hash(individual, archive->v_size)) != NULL;
+}
+
+/* archive_is_dominated: checks if the archive holds a solution no worse than some costs in every objective
+ * parameter: archive
+ * parameter: costs of the objective functions
+ * returns: 1 if the costs are weakly dominated by the archive, 0 otherwise
+ */
+int archive_is_dominated(struct archive *archive, float *objectives_functions)
+{
+	float key[NUMBER_OF_OBJECTIVES];
+	/* iterator */
+	int iterator_objective;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		key[iterator_objective] = objectives_functions[iterator_objective] * objective_sense[iterator_objective];
+	}
+	return nd_node_dominated(archive->root, key);
+}
+
+/* archive_insert: inserts a solution in the archive, evicting the members it dominates
+ * parameter: archive
+ * parameter: solution
+ * parameter: costs of the objective functions
+ * returns: 1 if the solution was inserted, 0 if it is a duplicate, is weakly dominated by a member or was truncated away
+ */
+int archive_insert(struct archive *archive, int *individual, float *objectives_functions)
+{
+	struct pareto_element *element;
+	unsigned long long hash = archive_hash(individual, archive->v_size);
+	float key[NUMBER_OF_OBJECTIVES];
+	/* iterator */
+	int iterator_objective;
+	/* duplicates are rejected without looking at the costs */
+	if (find_solution(archive, individual, hash) != NULL)
+	{
+		return 0;
+	}
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		key[iterator_objective] = objectives_functions[iterator_objective] * objective_sense[iterator_objective];
+	}
+	if (nd_node_update(archive, archive->root, key))
+	{
+		return 0;
+	}
+	/* the solution is not dominated, keep a copy of it in a spare element if there is one */
+	if (archive->spare != NULL)
+	{
+		element = archive->spare;
+		archive->spare = element->next;
+		memcpy(element->solution, individual, archive->v_size * sizeof (int));
+		memcpy(element->costs, objectives_functions, NUMBER_OF_OBJECTIVES * sizeof (float));
+		memcpy(element->key, key, NUMBER_OF_OBJECTIVES * sizeof (float));
+		element->prev = NULL;
+	}
+	else
+	{
+		element = pareto_create(archive->v_size, individual, objectives_functions);
+	}
+	element->hash = hash;
+	if (archive->size >= archive->number_of_buckets)
+	{
+		archive_rehash(archive);
+	}
+	element->hash_next = archive->buckets[hash & (archive->number_of_buckets - 1)];
+	archive->buckets[hash & (archive->number_of_buckets - 1)] = element;
+	element->next = archive->head;
+	if (archive->head != NULL)
+	{
+		archive->head->prev = element;
+	}
+	archive->head = element;
+	archive->size++;
+	nd_node_insert(archive->root, element);
+	if (archive->capacity != ARCHIVE_UNBOUNDED && archive->size > archive->capacity)
+	{
+		return archive_truncate(archive) != element;
+	}
+	return 1;
+}
@@ -0,0 +1,84 @@
+/*
+ * archive.h: Virtual Machine Placement Problem - Pareto Archive Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef ARCHIVE_H
+#define ARCHIVE_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "population.h"
+#include "nds.h"
+#include "indicators.h"
+/* definitions */
+#define ARCHIVE_INITIAL_BUCKETS 64
+#define ARCHIVE_UNBOUNDED 0
+#define ARCHIVE_TRUNCATE_EPSILON 0
+#define ARCHIVE_TRUNCATE_CROWDING 1
+#define ARCHIVE_TRUNCATE_HYPERVOLUME 2
+#define ARCHIVE_GRID_DIVISIONS 10
+#define ARCHIVE_REFERENCE 1.1f
+#define ND_TREE_LEAF_SIZE 20
+#define ND_TREE_CHILDREN 6
+
+/* structure of an element of the known Pareto set */
+struct pareto_element
+{
+	int *solution;
+	float *costs;
+	struct pareto_element *prev;
+	struct pareto_element *next;
+	/* hash of the solution and next element of its bucket */
+	unsigned long long hash;
+	struct pareto_element *hash_next;
+	/* costs multiplied by the objective sense, every objective is minimized */
+	float key[NUMBER_OF_OBJECTIVES];
+};
+
+/* node of the ND-tree over the keys of the archive */
+struct nd_node;
+
+/* structure of the archive of the known Pareto set: only mutually non-dominated solutions are kept */
+struct archive
+{
+	int v_size;
+	int size;
+	/* members as a doubly linked list, the order is not meaningful */
+	struct pareto_element *head;
+	/* hash table of the solutions, the number of buckets is a power of 2 */
+	int number_of_buckets;
+	struct pareto_element **buckets;
+	/* spatial index of the keys */
+	struct nd_node *root;
+	/* maximum number of members, ARCHIVE_UNBOUNDED for no limit, and the strategy to remove the extra one */
+	int capacity;
+	int truncation;
+	/* state of the random generator of the sampled hypervolume contributions, for erand48 */
+	unsigned short state[3];
+	/* evicted elements kept to hold the next members, linked by next */
+	struct pareto_element *spare;
+	/* arrays of the truncation, for capacity + 1 members */
+	struct pareto_element **truncation_members;
+	float *truncation_keys;
+	double *truncation_measures;
+	int *truncation_order;
+	/* scratch arena of the exact hypervolume contributions */
+	struct scratch *truncation_scratch;
+};
+
+/* function headers definitions */
+struct archive * archive_create(int v_size, int capacity, int truncation);
+void archive_free(struct archive *archive);
+int archive_insert(struct archive *archive, int *individual, float *objectives_functions);
+int archive_is_dominated(struct archive *archive, float *objectives_functions);
+int archive_contains(struct archive *archive, int *individual);
+unsigned long long archive_hash(int *individual, int v_size);
+
+#endif
@@ -0,0 +1,1114 @@
+/*
+ * bench.c: Virtual Machine Placement Problem - Benchmark of the Dominance Kernel, Non-Dominated Sorting, the Kernels of a Generation and the Convergence
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "population.h"
+#include "variation.h"
+#include "nds.h"
+#include "datacenter.h"
+#include "loader.h"
+#include "vmpb.h"
+#include "generator.h"
+#include "common.h"
+#include "initialization.h"
+#include "reparation.h"
+#include "pareto.h"
+#include "archive.h"
+#include "config.h"
+#include "scratch.h"
+#include "pool.h"
+#include "bounds.h"
+#include "indicators.h"
+#include "stopping.h"
+/* definitions */
+#define BENCH_REPETITIONS 5
+/* a kernel runs at least this long, in seconds, and at most BENCH_MAX_REPETITIONS times */
+#define BENCH_MIN_TIME 0.5
+#define BENCH_MAX_REPETITIONS 100000
+#define BENCH_INDIVIDUALS 100
+/* convergence benchmark: deadline of each run in milliseconds, samples of its trace, fraction of the best final
+ * hypervolume that sets the time to quality, and Monte Carlo samples of the hypervolume of the bigger fronts */
+#define BENCH_DEADLINE 2000.0
+#define BENCH_TRACE_SAMPLES 20
+#define BENCH_TRACE_FILE "results/convergence_trace"
+#define BENCH_TARGET 0.95
+#define BENCH_HV_SAMPLES (16 * HV_SAMPLES)
+#define BENCH_UNIFORM 0
+#define BENCH_LAYERED 1
+#define BENCH_TIES 2
+
+/* legacy_is_dominated: the dominance expression used before the dominance kernel, it misses 7 of the tie patterns
+ * parameter: objectives block of the solutions [individual][objective]
+ * parameter: identificator of the individual a
+ * parameter: identificator of the individual b
+ * returns: 1 if a dominates b, -1 if b dominates a, 0 if both a and b are non-dominated 
+ */
+static int legacy_is_dominated(float * solutions, int a, int b)
+{
+	/* objectives of both individuals */
+	float *solution_a = solutions + a * NUMBER_OF_OBJECTIVES;
+	float *solution_b = solutions + b * NUMBER_OF_OBJECTIVES;
+	/* if a dominates b */
+	/* a better in all objectives */
+	if((solution_a[0] < solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	/* a better or equal in one objective and better in the others */
+	(solution_a[0] <= solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] <= solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] <= solution_b[4]) ||
+	/* a better or equal in two objectives and better in the others */
+	(solution_a[0] <= solution_b[0] && solution_a[1] <= solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] <= solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] <= solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] <= solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] <= solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] <= solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] <= solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] <= solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] <= solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] <= solution_b[4]) ||
+	/* a better or equal in three objectives and better in the others */
+	(solution_a[0] <= solution_b[0] && solution_a[1] <= solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] > solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] <= solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] <= solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] <= solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] <= solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] <= solution_b[1] && solution_a[2] > solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] <= solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] <= solution_b[4]) ||
+	/* a better or equal in four objectives and better in the others */
+	(solution_a[0] <= solution_b[0] && solution_a[1] <= solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] < solution_b[4]) ||
+	(solution_a[0] <= solution_b[0] && solution_a[1] < solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] <= solution_b[4]) ||
+	(solution_a[0] < solution_b[0] && solution_a[1] <= solution_b[1] && solution_a[2] >= solution_b[2] && solution_a[3] >= solution_b[3] 
+	&& solution_a[4] <= solution_b[4]))
+	{
+		return 1;
+	}
+
+	/* if b dominates a */
+	/* a better in all objectives */
+	if((solution_b[0] < solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	/* a better or equal in one objective and better in the others */
+	(solution_b[0] <= solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] <= solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] <= solution_a[4]) ||
+	/* a better or equal in two objectives and better in the others */
+	(solution_b[0] <= solution_a[0] && solution_b[1] <= solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] <= solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] <= solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] <= solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] <= solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] <= solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] <= solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] <= solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] <= solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] <= solution_a[4]) ||
+	/* a better or equal in three objectives and better in the others */
+	(solution_b[0] <= solution_a[0] && solution_b[1] <= solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] > solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] <= solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] <= solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] <= solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] <= solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] <= solution_a[1] && solution_b[2] > solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] <= solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] <= solution_a[4]) ||
+	/* a better or equal in four objectives and better in the others */
+	(solution_b[0] <= solution_a[0] && solution_b[1] <= solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] < solution_a[4]) ||
+	(solution_b[0] <= solution_a[0] && solution_b[1] < solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] <= solution_a[4]) ||
+	(solution_b[0] < solution_a[0] && solution_b[1] <= solution_a[1] && solution_b[2] >= solution_a[2] && solution_b[3] >= solution_a[3] 
+	&& solution_b[4] <= solution_a[4]))
+	{
+		return -1;
+	}
+	/* if comes here, both are non-dominated */
+	return 0;
+}
+
+/* legacy_non_dominated_sorting: the repeated-sweep sorting used before the NDS module, kept as reference
+ * parameter: objectives block of the solutions [individual][objective]
+ * parameter: number of individuals
+ * returns: array with the Pareto front
+ */
+static int* legacy_non_dominated_sorting(float * solutions, int number_of_individuals)
+{
+	/* iterators */
+	int iterator_solution = 0;
+	int iterator_comparision = 0;
+	/* Pareto front identificator initializated to 1 */
+	int actual_pareto_front = 1;
+	/* Pareto fronts array, initializated to 0 */
+	int *pareto_fronts = (int *) calloc (number_of_individuals + 1, sizeof (int));
+	/* auxiliar integers */
+	int dont_add;
+	int allocated_solutions = 0;
+	/* while all the solutions have been evaluated */
+	while (allocated_solutions < number_of_individuals)
+	{
+		for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+		{
+			dont_add = 0;
+			if (pareto_fronts[iterator_solution] == 0)
+			{
+				for (iterator_comparision = 0; iterator_comparision < number_of_individuals; iterator_comparision++)
+				{
+					if ((iterator_solution != iterator_comparision && pareto_fronts[iterator_comparision] == 0) ||
+						pareto_fronts[iterator_comparision] == actual_pareto_front)
+					{
+						if (legacy_is_dominated(solutions, iterator_solution, iterator_comparision) == -1)
+						{
+							dont_add = 1;
+							break;
+						}
+					}
+				}
+				if (dont_add == 0)
+				{
+					pareto_fronts[iterator_solution] = actual_pareto_front;
+					allocated_solutions++;
+				}
+			}
+		}
+		actual_pareto_front++;
+	}
+	return pareto_fronts;
+}
+
+/* elapsed: seconds between two instants
+ * parameter: start instant
+ * parameter: end instant
+ * returns: elapsed seconds
+ */
+static double elapsed(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) + (end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/* generate_objectives: generates a random objectives block
+ * parameter: number of individuals
+ * parameter: BENCH_UNIFORM for independent objectives, BENCH_LAYERED for many fronts, BENCH_TIES for few distinct values
+ * returns: objectives block [individual][objective]
+ */
+static float * generate_objectives(int number_of_individuals, int distribution)
+{
+	float *objectives = (float *) malloc ((size_t) number_of_individuals * NUMBER_OF_OBJECTIVES * sizeof (float));
+	/* iterators */
+	int iterator_solution;
+	int iterator_objective;
+	float layer;
+	for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+	{
+		/* the layered solutions share a random distance to the ideal point in every objective */
+		layer = (float) drand48();
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			if (distribution == BENCH_UNIFORM)
+			{
+				objectives[iterator_solution * NUMBER_OF_OBJECTIVES + iterator_objective] = (float) drand48() * 1000;
+			}
+			else if (distribution == BENCH_LAYERED)
+			{
+				objectives[iterator_solution * NUMBER_OF_OBJECTIVES + iterator_objective] = 1000 * layer + (float) drand48() * 50;
+			}
+			else
+			{
+				objectives[iterator_solution * NUMBER_OF_OBJECTIVES + iterator_objective] = (float) (lrand48() % 4);
+			}
+		}
+		/* revenue and QoS are maximized */
+		objectives[iterator_solution * NUMBER_OF_OBJECTIVES + 2] = -objectives[iterator_solution * NUMBER_OF_OBJECTIVES + 2];
+		objectives[iterator_solution * NUMBER_OF_OBJECTIVES + 3] = -objectives[iterator_solution * NUMBER_OF_OBJECTIVES + 3];
+	}
+	return objectives;
+}
+
+/* count_differences: counts the solutions placed in different Pareto fronts
+ * parameter: first array of Pareto fronts
+ * parameter: second array of Pareto fronts
+ * parameter: number of individuals
+ * returns: number of differences
+ */
+static int count_differences(int *fronts_a, int *fronts_b, int number_of_individuals)
+{
+	int iterator_solution;
+	int differences = 0;
+	for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+	{
+		differences += fronts_a[iterator_solution] != fronts_b[iterator_solution];
+	}
+	return differences;
+}
+
+/* reference_dominance: plain Pareto dominance, one objective at a time
+ * parameter: objectives of the solution a
+ * parameter: objectives of the solution b
+ * returns: 1 if a dominates b, -1 if b dominates a, 0 if both a and b are non-dominated
+ */
+static int reference_dominance(float *solution_a, float *solution_b)
+{
+	int iterator_objective;
+	int a_better = 0;
+	int b_better = 0;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		/* revenue and QoS are maximized */
+		if (iterator_objective == 2 || iterator_objective == 3)
+		{
+			a_better |= solution_a[iterator_objective] > solution_b[iterator_objective];
+			b_better |= solution_a[iterator_objective] < solution_b[iterator_objective];
+		}
+		else
+		{
+			a_better |= solution_a[iterator_objective] < solution_b[iterator_objective];
+			b_better |= solution_a[iterator_objective] > solution_b[iterator_objective];
+		}
+	}
+	if (a_better && !b_better)
+	{
+		return 1;
+	}
+	if (b_better && !a_better)
+	{
+		return -1;
+	}
+	return 0;
+}
+
+/* check_dominance: differential test of the dominance kernel against the reference and the legacy expression
+ * parameter: number of pairs of solutions to compare
+ * returns: number of pairs where the kernel is wrong
+ */
+static int check_dominance(int number_of_pairs)
+{
+	float *objectives = generate_objectives(2 * number_of_pairs, BENCH_TIES);
+	/* iterator */
+	int iterator_pair;
+	int kernel;
+	int legacy;
+	int wrong = 0;
+	int legacy_misses = 0;
+	int checksum = 0;
+	struct timespec start;
+	struct timespec end;
+	double time_kernel;
+	double time_legacy;
+	for (iterator_pair = 0; iterator_pair < number_of_pairs; iterator_pair++)
+	{
+		kernel = is_dominated(objectives, 2 * iterator_pair, 2 * iterator_pair + 1);
+		legacy = legacy_is_dominated(objectives, 2 * iterator_pair, 2 * iterator_pair + 1);
+		/* the kernel must match the reference, and the legacy expression whenever it finds a dominance */
+		if (kernel != reference_dominance(objectives + 2 * iterator_pair * NUMBER_OF_OBJECTIVES,
+			objectives + (2 * iterator_pair + 1) * NUMBER_OF_OBJECTIVES) || (legacy != 0 && legacy != kernel))
+		{
+			wrong++;
+		}
+		legacy_misses += legacy == 0 && kernel != 0;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (iterator_pair = 0; iterator_pair < number_of_pairs; iterator_pair++)
+	{
+		checksum += is_dominated(objectives, 2 * iterator_pair, 2 * iterator_pair + 1);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	time_kernel = elapsed(&start, &end);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (iterator_pair = 0; iterator_pair < number_of_pairs; iterator_pair++)
+	{
+		checksum -= legacy_is_dominated(objectives, 2 * iterator_pair, 2 * iterator_pair + 1);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	time_legacy = elapsed(&start, &end);
+	printf("dominance: %d pairs, %d wrong, %d dominances missed by the legacy expression (checksum %d)\n",
+		number_of_pairs, wrong, legacy_misses, checksum);
+	printf("dominance: kernel %.2f ns/pair, legacy %.2f ns/pair\n\n",
+		time_kernel * 1e9 / number_of_pairs, time_legacy * 1e9 / number_of_pairs);
+	free(objectives);
+	return wrong;
+}
+
+/* context of the kernels of a generation, over a datacenter instance and a population of it */
+struct kernel_context
+{
+	struct datacenter *datacenter;
+	struct population *population;
+	struct pool *pool;
+	struct scratch *scratch;
+	/* instance file parsed by the parse kernels, text and binary */
+	const char *path_to_file;
+	/* repetition of the kernel, seeding the populations it prepares */
+	int repetition;
+	/* legacy Pareto list and archive filled by the insertion kernels */
+	struct pareto_element *pareto_head;
+	struct archive *archive;
+	int checksum;
+};
+
+/* kernel_parse: loads the instance file and releases it
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void kernel_parse(struct kernel_context *context)
+{
+	struct datacenter loaded;
+	if (load_datacenter(context->path_to_file, &loaded) != 0)
+	{
+		exit(1);
+	}
+	context->checksum += loaded.v_size;
+	datacenter_free(&loaded);
+}
+
+/* kernel_load_utilization: loads the utilization of the physical machines of the population
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void kernel_load_utilization(struct kernel_context *context)
+{
+	load_utilization(context->population, context->datacenter->V, context->pool);
+}
+
+/* kernel_load_network_utilization: loads the utilization of the network links of the population
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void kernel_load_network_utilization(struct kernel_context *context)
+{
+	load_network_utilization(context->population, context->datacenter->topology, context->datacenter->T, context->pool,
+		context->scratch);
+	scratch_reset(context->scratch);
+}
+
+/* kernel_load_objectives: calculates the objective functions of the population
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void kernel_load_objectives(struct kernel_context *context)
+{
+	struct datacenter *datacenter = context->datacenter;
+	load_objectives(context->population, datacenter->H, datacenter->V, datacenter->T, datacenter->K, context->pool);
+}
+
+/* kernel_non_dominated_sorting: sorts the population in non-dominated fronts
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void kernel_non_dominated_sorting(struct kernel_context *context)
+{
+	int *fronts = non_dominated_sorting(context->population->objectives, context->population->number_of_individuals);
+	context->checksum += fronts[0];
+	free(fronts);
+}
+
+/* kernel_is_dominated: compares every pair of individuals of the population
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void kernel_is_dominated(struct kernel_context *context)
+{
+	/* iterators */
+	int iterator_individual;
+	int iterator_individual_again;
+	int number_of_individuals = context->population->number_of_individuals;
+	for (iterator_individual = 0; iterator_individual < number_of_individuals; iterator_individual++)
+	{
+		for (iterator_individual_again = 0; iterator_individual_again < number_of_individuals; iterator_individual_again++)
+		{
+			context->checksum += is_dominated(context->population->objectives, iterator_individual, iterator_individual_again);
+		}
+	}
+}
+
+/* prepare_repair: draws a new random population to repair, with its utilization loaded
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void prepare_repair(struct kernel_context *context)
+{
+	struct datacenter *datacenter = context->datacenter;
+	initialization(context->population, datacenter->V, MAX_SLA, context->repetition + 1, context->pool);
+	load_utilization(context->population, datacenter->V, context->pool);
+	load_network_utilization(context->population, datacenter->topology, datacenter->T, context->pool, context->scratch);
+	scratch_reset(context->scratch);
+}
+
+/* kernel_repair: repairs the population, repair_individual on each individual
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void kernel_repair(struct kernel_context *context)
+{
+	reparation(context->population, context->datacenter, MAX_SLA, REPAIR_POLICY, context->repetition + 1, context->pool,
+		context->scratch);
+	scratch_reset(context->scratch);
+}
+
+/* release_insertions: releases the legacy Pareto list and the archive filled by the insertion kernels
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void release_insertions(struct kernel_context *context)
+{
+	struct pareto_element *element;
+	while (context->pareto_head != NULL)
+	{
+		element = context->pareto_head;
+		context->pareto_head = element->next;
+		free(element->solution);
+		free(element->costs);
+		free(element);
+	}
+	if (context->archive != NULL)
+	{
+		archive_free(context->archive);
+		context->archive = NULL;
+	}
+}
+
+/* kernel_pareto_insert: inserts every individual of the population in a new legacy Pareto list
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void kernel_pareto_insert(struct kernel_context *context)
+{
+	/* iterator */
+	int iterator_individual;
+	for (iterator_individual = 0; iterator_individual < context->population->number_of_individuals; iterator_individual++)
+	{
+		context->pareto_head = pareto_insert(context->pareto_head, context->datacenter->v_size, GENES(context->population, iterator_individual),
+			OBJECTIVES(context->population, iterator_individual));
+	}
+}
+
+/* prepare_archive_insert: releases the previous insertions and creates an empty archive
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void prepare_archive_insert(struct kernel_context *context)
+{
+	release_insertions(context);
+	context->archive = archive_create(context->datacenter->v_size, ARCHIVE_CAPACITY, ARCHIVE_TRUNCATION);
+}
+
+/* kernel_archive_insert: inserts every individual of the population in the archive of the known Pareto set
+ * parameter: kernel context
+ * returns: nothing, it's void
+ */
+static void kernel_archive_insert(struct kernel_context *context)
+{
+	/* iterator */
+	int iterator_individual;
+	for (iterator_individual = 0; iterator_individual < context->population->number_of_individuals; iterator_individual++)
+	{
+		context->checksum += archive_insert(context->archive, GENES(context->population, iterator_individual),
+			OBJECTIVES(context->population, iterator_individual));
+	}
+}
+
+/* run_kernel: times a kernel, repeated for at least BENCH_MIN_TIME, and prints its cost per operation
+ * parameter: name of the kernel
+ * parameter: operations done by each run of the kernel
+ * parameter: untimed preparation of each run, NULL if none
+ * parameter: kernel
+ * parameter: kernel context
+ * returns: nanoseconds per operation
+ */
+static double run_kernel(const char *name, double number_of_operations, void (*prepare)(struct kernel_context *),
+	void (*kernel)(struct kernel_context *), struct kernel_context *context)
+{
+	struct timespec start;
+	struct timespec end;
+	double total = 0.0;
+	double nanoseconds;
+	for (context->repetition = 0; context->repetition < BENCH_MAX_REPETITIONS && total < BENCH_MIN_TIME; context->repetition++)
+	{
+		if (prepare != NULL)
+		{
+			prepare(context);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		kernel(context);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		total += elapsed(&start, &end);
+	}
+	nanoseconds = total * 1e9 / context->repetition / number_of_operations;
+	printf("%-26s %10.0f %8d %14.1f %14.0f\n", name, number_of_operations, context->repetition, nanoseconds, 1e9 / nanoseconds);
+	return nanoseconds;
+}
+
+/* bench_kernels: benchmark of the kernels of a generation over an instance file or a synthetic instance, on one
+ * thread unless told otherwise. Each kernel reports its nanoseconds per operation and operations per second; the
+ * operation is an individual, a pair of individuals, an insertion, or a load of the instance file
+ * parameter: number of arguments
+ * parameter: arguments: kernels (datacenter_file | h_size v_size) [individuals] [threads]
+ * returns: exit state
+ */
+static int bench_kernels(int argc, char *argv[])
+{
+	struct datacenter datacenter;
+	struct generator_options options;
+	struct kernel_context context;
+	char text_file[] = "/tmp/bench_XXXXXX.vmp";
+	char binary_file[] = "/tmp/bench_XXXXXX.vmpb";
+	int generated = argc > 3 && atoi(argv[2]) > 0 && atoi(argv[3]) > 0;
+	int number_of_individuals = argc > 3 + generated ? atoi(argv[3 + generated]) : BENCH_INDIVIDUALS;
+	int number_of_threads = argc > 4 + generated ? atoi(argv[4 + generated]) : 1;
+	int descriptor;
+	double evaluation = 0.0;
+	if (argc < 3 || number_of_individuals <= 0 || number_of_threads < 0)
+	{
+		printf("[ERROR] usage: %s kernels (datacenter_file | h_size v_size) [individuals] [threads]\n", argv[0]);
+		return 1;
+	}
+	memset(&context, 0, sizeof (struct kernel_context));
+	if (generated)
+	{
+		generator_defaults(&options, atoi(argv[2]), atoi(argv[3]));
+		generator_create(&options, &datacenter);
+	}
+	else if (load_datacenter(argv[2], &datacenter) != 0)
+	{
+		return 1;
+	}
+	printf("instance: H=%d, V=%d, L=%d, %d pairs of virtual machines with traffic, %d individuals, %d threads\n",
+		datacenter.h_size, datacenter.v_size, datacenter.l_size, datacenter.T->number_of_pairs, number_of_individuals, number_of_threads);
+	printf("%-26s %10s %8s %14s %14s\n", "kernel", "ops", "runs", "ns/op", "ops/s");
+	context.datacenter = &datacenter;
+	context.pool = number_of_threads == 1 ? NULL : pool_create(number_of_threads);
+	context.scratch = scratch_create(0);
+	/* parse: the instance file, or the synthetic instance written in both formats */
+	if (!generated)
+	{
+		context.path_to_file = argv[2];
+		run_kernel("parse", 1, NULL, kernel_parse, &context);
+	}
+	else
+	{
+		descriptor = mkstemps(binary_file, 5);
+		if (descriptor >= 0 && (close(descriptor), vmpb_write(binary_file, &datacenter) == 0))
+		{
+			context.path_to_file = binary_file;
+			run_kernel("parse (binary)", 1, NULL, kernel_parse, &context);
+		}
+		remove(binary_file);
+		descriptor = datacenter.v_size <= GENERATOR_TEXT_LIMIT ? mkstemps(text_file, 4) : -1;
+		if (descriptor >= 0 && (close(descriptor), generator_write(text_file, &datacenter) == 0))
+		{
+			context.path_to_file = text_file;
+			run_kernel("parse (text)", 1, NULL, kernel_parse, &context);
+		}
+		if (descriptor >= 0)
+		{
+			remove(text_file);
+		}
+	}
+	/* the population of the other kernels: random and repaired, as P_0 */
+	context.population = population_create(number_of_individuals, datacenter.h_size, datacenter.v_size, datacenter.l_size);
+	run_kernel("repair_individual", number_of_individuals, prepare_repair, kernel_repair, &context);
+	evaluation += run_kernel("load_utilization", number_of_individuals, NULL, kernel_load_utilization, &context);
+	evaluation += run_kernel("load_network_utilization", number_of_individuals, NULL, kernel_load_network_utilization, &context);
+	evaluation += run_kernel("load_objectives", number_of_individuals, NULL, kernel_load_objectives, &context);
+	run_kernel("non_dominated_sorting", number_of_individuals, NULL, kernel_non_dominated_sorting, &context);
+	run_kernel("is_dominated", (double) number_of_individuals * number_of_individuals, NULL, kernel_is_dominated, &context);
+	run_kernel("pareto_insert", number_of_individuals, release_insertions, kernel_pareto_insert, &context);
+	run_kernel("archive_insert", number_of_individuals, prepare_archive_insert, kernel_archive_insert, &context);
+	release_insertions(&context);
+	printf("evaluations/s: %.0f (load_utilization, load_network_utilization and load_objectives of an individual) (checksum %d)\n",
+		1e9 / evaluation, context.checksum);
+	population_free(context.population);
+	scratch_free(context.scratch);
+	pool_free(context.pool);
+	datacenter_free(&datacenter);
+	return 0;
+}
+
+/* structure of the convergence trace of a run: the samples of its known Pareto front, normalized by the objective
+ * bounds of the instance, so 0 is the ideal point and 1 the nadir point in every objective */
+struct convergence_run
+{
+	int number_of_threads;
+	int number_of_samples;
+	double *milliseconds;
+	int *generations;
+	long long *evaluations;
+	/* the points of the sample s are points[offsets[s] .. offsets[s + 1]) */
+	int *offsets;
+	float *points;
+};
+
+/* load_convergence_trace: loads the convergence trace written by imavmp with trace-ms, a line per member of each sample
+ * parameter: path to the convergence trace
+ * parameter: objective bounds of the instance
+ * parameter: run to fill
+ * returns: 0 if the trace has at least a sample, -1 otherwise
+ */
+static int load_convergence_trace(const char *path_to_file, const struct objective_bounds *bounds, struct convergence_run *run)
+{
+	FILE *trace = fopen(path_to_file, "r");
+	/* iterator */
+	int iterator_objective;
+	int number_of_points = 0;
+	int capacity_of_samples = 64;
+	int capacity_of_points = 1024;
+	double milliseconds;
+	int generation;
+	long long evaluations;
+	float costs[NUMBER_OF_OBJECTIVES];
+	if (trace == NULL)
+	{
+		return -1;
+	}
+	run->number_of_samples = 0;
+	run->milliseconds = (double *) malloc (capacity_of_samples * sizeof (double));
+	run->generations = (int *) malloc (capacity_of_samples * sizeof (int));
+	run->evaluations = (long long *) malloc (capacity_of_samples * sizeof (long long));
+	run->offsets = (int *) malloc ((capacity_of_samples + 1) * sizeof (int));
+	run->points = (float *) malloc (capacity_of_points * NUMBER_OF_OBJECTIVES * sizeof (float));
+	run->offsets[0] = 0;
+	while (fscanf(trace, "%lf %d %lld %f %f %f %f %f", &milliseconds, &generation, &evaluations, &costs[0], &costs[1], &costs[2],
+		&costs[3], &costs[4]) == 3 + NUMBER_OF_OBJECTIVES)
+	{
+		/* a new sample starts when the time changes */
+		if (run->number_of_samples == 0 || milliseconds != run->milliseconds[run->number_of_samples - 1])
+		{
+			if (run->number_of_samples == capacity_of_samples)
+			{
+				capacity_of_samples *= 2;
+				run->milliseconds = (double *) realloc (run->milliseconds, capacity_of_samples * sizeof (double));
+				run->generations = (int *) realloc (run->generations, capacity_of_samples * sizeof (int));
+				run->evaluations = (long long *) realloc (run->evaluations, capacity_of_samples * sizeof (long long));
+				run->offsets = (int *) realloc (run->offsets, (capacity_of_samples + 1) * sizeof (int));
+			}
+			run->milliseconds[run->number_of_samples] = milliseconds;
+			run->generations[run->number_of_samples] = generation;
+			run->evaluations[run->number_of_samples] = evaluations;
+			run->number_of_samples++;
+		}
+		if (number_of_points == capacity_of_points)
+		{
+			capacity_of_points *= 2;
+			run->points = (float *) realloc (run->points, capacity_of_points * NUMBER_OF_OBJECTIVES * sizeof (float));
+		}
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			run->points[number_of_points * NUMBER_OF_OBJECTIVES + iterator_objective] =
+				objective_bounds_normalize(bounds, iterator_objective, costs[iterator_objective]);
+		}
+		number_of_points++;
+		run->offsets[run->number_of_samples] = number_of_points;
+	}
+	fclose(trace);
+	return run->number_of_samples > 0 ? 0 : -1;
+}
+
+/* convergence_run_free: releases the samples of a run
+ * parameter: run
+ * returns: nothing, it's void
+ */
+static void convergence_run_free(struct convergence_run *run)
+{
+	free(run->milliseconds);
+	free(run->generations);
+	free(run->evaluations);
+	free(run->offsets);
+	free(run->points);
+}
+
+/* normalized_hypervolume: hypervolume of normalized points, as a fraction of the box between the ideal point and the
+ * reference point, exact up to HV_EXACT_LIMIT points and estimated by Monte Carlo sampling over them
+ * parameter: points, normalized
+ * parameter: number of points
+ * returns: hypervolume, between 0 and 1
+ */
+static double normalized_hypervolume(const float *points, int number_of_points)
+{
+	/* iterator */
+	int iterator_objective;
+	float reference[NUMBER_OF_OBJECTIVES];
+	double box = 1.0;
+	unsigned short state[3] = {0x330E, 0xABCD, 0x1234};
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		reference[iterator_objective] = STOPPING_REFERENCE;
+		box *= STOPPING_REFERENCE;
+	}
+	if (number_of_points <= HV_EXACT_LIMIT)
+	{
+		return hypervolume(points, number_of_points, reference, NULL) / box;
+	}
+	return hypervolume_monte_carlo(points, number_of_points, NULL, reference, BENCH_HV_SAMPLES, state) / box;
+}
+
+/* inverted_generational_distance: mean distance of the points of the reference front to their nearest point
+ * parameter: points, normalized
+ * parameter: number of points
+ * parameter: reference front, normalized
+ * parameter: number of points of the reference front
+ * returns: IGD, 0 if the points cover the reference front
+ */
+static double inverted_generational_distance(const float *points, int number_of_points, const float *front, int front_size)
+{
+	/* iterators */
+	int iterator_front;
+	int iterator_point;
+	int iterator_objective;
+	double difference;
+	double distance;
+	double nearest;
+	double total = 0.0;
+	for (iterator_front = 0; iterator_front < front_size; iterator_front++)
+	{
+		nearest = INFINITY;
+		for (iterator_point = 0; iterator_point < number_of_points; iterator_point++)
+		{
+			distance = 0.0;
+			for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+			{
+				difference = (double) front[iterator_front * NUMBER_OF_OBJECTIVES + iterator_objective] -
+					points[iterator_point * NUMBER_OF_OBJECTIVES + iterator_objective];
+				distance += difference * difference;
+			}
+			nearest = fmin(nearest, distance);
+		}
+		total += sqrt(nearest);
+	}
+	return total / front_size;
+}
+
+/* bench_instance: runs imavmp over an instance with each number of threads and writes the hypervolume and IGD of each
+ * sample of its known Pareto front. The IGD is measured against the non-dominated points of the last samples of every
+ * run, so the runs of an instance are compared with the same reference front
+ * parameter: path to imavmp
+ * parameter: path to the datacenter infrastructure file
+ * parameter: name of the instance in the results
+ * parameter: objective bounds of the instance
+ * parameter: deadline of each run, in milliseconds
+ * parameter: numbers of threads of the runs
+ * parameter: number of runs
+ * parameter: results file
+ * returns: 0 if every run was traced, -1 otherwise
+ */
+static int bench_instance(const char *imavmp, const char *path_to_file, const char *name, const struct objective_bounds *bounds,
+	double deadline, const int *threads, int number_of_runs, FILE *results)
+{
+	struct convergence_run *runs = (struct convergence_run *) malloc (number_of_runs * sizeof (struct convergence_run));
+	struct convergence_run *run;
+	char command[3 * CONFIG_LINE_SIZE];
+	/* iterators */
+	int iterator_run;
+	int iterator_sample;
+	int number_of_loaded = 0;
+	int last;
+	int front_size = 0;
+	float *front;
+	double *hypervolumes;
+	double best_hypervolume = 0.0;
+	double igd = 0.0;
+	double target_time;
+	int result = 0;
+	/* the same seed gives the same generations whatever the number of threads, only their time changes */
+	for (iterator_run = 0; iterator_run < number_of_runs; iterator_run++)
+	{
+		remove(BENCH_TRACE_FILE);
+		snprintf(command, sizeof (command), "%s %s --seed 1 --generations 0 --deadline-ms %g --trace-ms %g --threads %d > /dev/null",
+			imavmp, path_to_file, deadline, deadline / BENCH_TRACE_SAMPLES, threads[iterator_run]);
+		runs[number_of_loaded].number_of_threads = threads[iterator_run];
+		if (system(command) != 0 || load_convergence_trace(BENCH_TRACE_FILE, bounds, &runs[number_of_loaded]) != 0)
+		{
+			printf("[ERROR] %s with %d threads was not traced: %s\n", name, threads[iterator_run], command);
+			result = -1;
+			continue;
+		}
+		front_size += runs[number_of_loaded].offsets[runs[number_of_loaded].number_of_samples] -
+			runs[number_of_loaded].offsets[runs[number_of_loaded].number_of_samples - 1];
+		number_of_loaded++;
+	}
+	remove(BENCH_TRACE_FILE);
+	/* reference front: the non-dominated points of the last samples */
+	front = (float *) malloc (((size_t) front_size * NUMBER_OF_OBJECTIVES + 1) * sizeof (float));
+	front_size = 0;
+	for (iterator_run = 0; iterator_run < number_of_loaded; iterator_run++)
+	{
+		last = runs[iterator_run].number_of_samples - 1;
+		memcpy(front + front_size * NUMBER_OF_OBJECTIVES, runs[iterator_run].points + runs[iterator_run].offsets[last] * NUMBER_OF_OBJECTIVES,
+			(runs[iterator_run].offsets[last + 1] - runs[iterator_run].offsets[last]) * NUMBER_OF_OBJECTIVES * sizeof (float));
+		front_size += runs[iterator_run].offsets[last + 1] - runs[iterator_run].offsets[last];
+	}
+	front_size = non_dominated_points(front, front_size);
+	for (iterator_run = 0; iterator_run < number_of_loaded; iterator_run++)
+	{
+		last = runs[iterator_run].number_of_samples - 1;
+		best_hypervolume = fmax(best_hypervolume, normalized_hypervolume(runs[iterator_run].points + runs[iterator_run].offsets[last] *
+			NUMBER_OF_OBJECTIVES, runs[iterator_run].offsets[last + 1] - runs[iterator_run].offsets[last]));
+	}
+	for (iterator_run = 0; iterator_run < number_of_loaded; iterator_run++)
+	{
+		run = &runs[iterator_run];
+		hypervolumes = (double *) malloc (run->number_of_samples * sizeof (double));
+		target_time = -1.0;
+		for (iterator_sample = 0; iterator_sample < run->number_of_samples; iterator_sample++)
+		{
+			hypervolumes[iterator_sample] = normalized_hypervolume(run->points + run->offsets[iterator_sample] * NUMBER_OF_OBJECTIVES,
+				run->offsets[iterator_sample + 1] - run->offsets[iterator_sample]);
+			igd = inverted_generational_distance(run->points + run->offsets[iterator_sample] * NUMBER_OF_OBJECTIVES,
+				run->offsets[iterator_sample + 1] - run->offsets[iterator_sample], front, front_size);
+			if (target_time < 0.0 && hypervolumes[iterator_sample] >= BENCH_TARGET * best_hypervolume)
+			{
+				target_time = run->milliseconds[iterator_sample];
+			}
+			fprintf(results, "%s\t%d\t%.3f\t%d\t%lld\t%.0f\t%d\t%.6f\t%.6f\n", name, run->number_of_threads, run->milliseconds[iterator_sample],
+				run->generations[iterator_sample], run->evaluations[iterator_sample],
+				run->evaluations[iterator_sample] * 1000.0 / run->milliseconds[iterator_sample],
+				run->offsets[iterator_sample + 1] - run->offsets[iterator_sample], hypervolumes[iterator_sample], igd);
+		}
+		last = run->number_of_samples - 1;
+		printf("%-20s %7d %11d %14.0f %12.6f %12.6f %14.3f\n", name, run->number_of_threads, run->generations[last],
+			run->evaluations[last] * 1000.0 / run->milliseconds[last], hypervolumes[last], igd, target_time);
+		free(hypervolumes);
+		convergence_run_free(run);
+	}
+	fflush(results);
+	free(front);
+	free(runs);
+	return result;
+}
+
+/* bench_convergence: end-to-end benchmark of imavmp over the bundled instances and synthetic ones, with 1 to the
+ * given number of threads doubling each time. Each run has the same seed and deadline, and its known Pareto front
+ * is sampled along the run: the hypervolume, IGD and evaluations per second of each sample are written to
+ * results/convergence_benchmark, a line per sample, and the last sample of each run is printed with the time it took
+ * to reach BENCH_TARGET of the best final hypervolume of the instance
+ * parameter: number of arguments
+ * parameter: arguments: convergence [deadline_ms] [max_threads] [imavmp] [h_size v_size ...]
+ * returns: exit state
+ */
+static int bench_convergence(int argc, char *argv[])
+{
+	const char *bundled[] = {"inputs/3x5.vmp", "inputs/4x8.vmp", "inputs/12x50.vmp", "inputs/100x1000.vmp"};
+	int number_of_bundled = sizeof (bundled) / sizeof (bundled[0]);
+	/* synthetic instances, as pairs of h_size and v_size */
+	int default_generated[] = {1000, 10000};
+	double deadline = argc > 2 ? atof(argv[2]) : BENCH_DEADLINE;
+	int max_threads = argc > 3 ? atoi(argv[3]) : (int) sysconf(_SC_NPROCESSORS_ONLN);
+	const char *imavmp = argc > 4 ? argv[4] : "./imavmp";
+	int number_of_generated = argc > 5 ? (argc - 5) / 2 : 1;
+	int threads[32];
+	int number_of_runs = 0;
+	/* iterator */
+	int iterator_instance;
+	struct datacenter datacenter;
+	struct generator_options options;
+	struct objective_bounds bounds;
+	char binary_file[] = "/tmp/bench_XXXXXX.vmpb";
+	char name[64];
+	int descriptor;
+	int result = 0;
+	FILE *results;
+	if (deadline <= 0.0 || max_threads <= 0 || (argc > 5 && (argc - 5) % 2 != 0))
+	{
+		printf("[ERROR] usage: %s convergence [deadline_ms] [max_threads] [imavmp] [h_size v_size ...]\n", argv[0]);
+		return 1;
+	}
+	results = fopen("results/convergence_benchmark", "w");
+	if (results == NULL)
+	{
+		printf("[ERROR] can not open results/convergence_benchmark\n");
+		return 1;
+	}
+	for (threads[0] = 1; threads[number_of_runs] < max_threads; number_of_runs++)
+	{
+		threads[number_of_runs + 1] = threads[number_of_runs] * 2 < max_threads ? threads[number_of_runs] * 2 : max_threads;
+	}
+	number_of_runs++;
+	fprintf(results, "instance\tthreads\tms\tgeneration\tevaluations\tevaluations_per_s\tpareto\thypervolume\tigd\n");
+	printf("%-20s %7s %11s %14s %12s %12s %14s\n", "instance", "threads", "generations", "evaluations/s", "hypervolume", "igd",
+		"ms_to_target");
+	for (iterator_instance = 0; iterator_instance < number_of_bundled + number_of_generated; iterator_instance++)
+	{
+		if (iterator_instance < number_of_bundled)
+		{
+			if (load_datacenter(bundled[iterator_instance], &datacenter) != 0)
+			{
+				result = 1;
+				continue;
+			}
+			objective_bounds_compute(&datacenter, MAX_SLA, &bounds);
+			snprintf(name, sizeof (name), "%dx%d", datacenter.h_size, datacenter.v_size);
+			datacenter_free(&datacenter);
+			result |= bench_instance(imavmp, bundled[iterator_instance], name, &bounds, deadline, threads, number_of_runs, results) != 0;
+			continue;
+		}
+		/* the synthetic instances are written as binary instance files, removed after their runs */
+		if (argc > 5)
+		{
+			generator_defaults(&options, atoi(argv[5 + 2 * (iterator_instance - number_of_bundled)]),
+				atoi(argv[6 + 2 * (iterator_instance - number_of_bundled)]));
+		}
+		else
+		{
+			generator_defaults(&options, default_generated[0], default_generated[1]);
+		}
+		if (options.h_size <= 0 || options.v_size <= 0)
+		{
+			result = 1;
+			continue;
+		}
+		generator_create(&options, &datacenter);
+		objective_bounds_compute(&datacenter, MAX_SLA, &bounds);
+		strcpy(binary_file, "/tmp/bench_XXXXXX.vmpb");
+		descriptor = mkstemps(binary_file, 5);
+		if (descriptor >= 0 && (close(descriptor), vmpb_write(binary_file, &datacenter) == 0))
+		{
+			snprintf(name, sizeof (name), "generated-%dx%d", datacenter.h_size, datacenter.v_size);
+			result |= bench_instance(imavmp, binary_file, name, &bounds, deadline, threads, number_of_runs, results) != 0;
+		}
+		else
+		{
+			result = 1;
+		}
+		remove(binary_file);
+		datacenter_free(&datacenter);
+	}
+	fclose(results);
+	return result;
+}
+
+/* main: benchmark of the dominance kernel and the non-dominated sorting methods against the legacy code, or of the
+ * kernels of a generation with the kernels argument, see bench_kernels, or of the convergence of imavmp with the
+ * convergence argument, see bench_convergence
+ * parameter: optional seed, or kernels or convergence and their arguments
+ * returns: exit state, 1 if the kernel is wrong or the fast and ENS-BS sortings disagree
+ */
+int main (int argc, char *argv[])
+{
+	int sizes[] = {20, 100, 200, 400, 800, 1600};
+	const char *distributions[] = {"uniform", "layered", "ties"};
+	/* iterators */
+	int iterator_size;
+	int iterator_distribution;
+	int iterator_repetition;
+	int number_of_individuals;
+	int legacy_differences;
+	int disagreements = 0;
+	int number_of_fronts;
+	int iterator_solution;
+	float *objectives;
+	int *fronts_legacy;
+	int *fronts_fast;
+	int *fronts_ens;
+	struct timespec start;
+	struct timespec end;
+	double time_legacy;
+	double time_fast;
+	double time_ens;
+
+	if (argc > 1 && strcmp(argv[1], "kernels") == 0)
+	{
+		return bench_kernels(argc, argv);
+	}
+	if (argc > 1 && strcmp(argv[1], "convergence") == 0)
+	{
+		return bench_convergence(argc, argv);
+	}
+	srand48(argc > 1 ? atol(argv[1]) : 1);
+	disagreements += check_dominance(1000000);
+	printf("%-8s %6s %6s %12s %12s %12s %8s\n", "dist", "N", "fronts", "legacy(ms)", "fast(ms)", "ens-bs(ms)", "legacy!=");
+	for (iterator_distribution = 0; iterator_distribution < 3; iterator_distribution++)
+	{
+		for (iterator_size = 0; iterator_size < (int) (sizeof (sizes) / sizeof (sizes[0])); iterator_size++)
+		{
+			number_of_individuals = sizes[iterator_size];
+			time_legacy = time_fast = time_ens = 0.0;
+			legacy_differences = 0;
+			number_of_fronts = 0;
+			for (iterator_repetition = 0; iterator_repetition < BENCH_REPETITIONS; iterator_repetition++)
+			{
+				objectives = generate_objectives(number_of_individuals, iterator_distribution);
+				clock_gettime(CLOCK_MONOTONIC, &start);
+				fronts_legacy = legacy_non_dominated_sorting(objectives, number_of_individuals);
+				clock_gettime(CLOCK_MONOTONIC, &end);
+				time_legacy += elapsed(&start, &end);
+				clock_gettime(CLOCK_MONOTONIC, &start);
+				fronts_fast = nds_sort(objectives, number_of_individuals, NDS_FAST);
+				clock_gettime(CLOCK_MONOTONIC, &end);
+				time_fast += elapsed(&start, &end);
+				clock_gettime(CLOCK_MONOTONIC, &start);
+				fronts_ens = nds_sort(objectives, number_of_individuals, NDS_ENS_BS);
+				clock_gettime(CLOCK_MONOTONIC, &end);
+				time_ens += elapsed(&start, &end);
+				/* both methods must agree, the legacy sweep only differs on ties its dominance check misses */
+				disagreements += count_differences(fronts_fast, fronts_ens, number_of_individuals);
+				legacy_differences += count_differences(fronts_legacy, fronts_ens, number_of_individuals);
+				for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+				{
+					if (fronts_ens[iterator_solution] > number_of_fronts)
+					{
+						number_of_fronts = fronts_ens[iterator_solution];
+					}
+				}
+				free(objectives);
+				free(fronts_legacy);
+				free(fronts_fast);
+				free(fronts_ens);
+			}
+			printf("%-8s %6d %6d %12.3f %12.3f %12.3f %8d\n", distributions[iterator_distribution], number_of_individuals, number_of_fronts,
+				time_legacy * 1000 / BENCH_REPETITIONS, time_fast * 1000 / BENCH_REPETITIONS, time_ens * 1000 / BENCH_REPETITIONS, legacy_differences);
+		}
+	}
+	if (disagreements != 0)
+	{
+		printf("[ERROR] the dominance kernel or the sortings disagree on %d cases\n", disagreements);
+		return 1;
+	}
+	return 0;
+}
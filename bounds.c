@@ -0,0 +1,311 @@
+/*
+ * bounds.c: Virtual Machine Placement Problem - Ideal and Nadir Objective Bounds
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include ideal and nadir objective bounds header */
+#include "bounds.h"
+
+/* physical or virtual machine in a fractional filling: what it gives for what it takes */
+struct bound_item
+{
+	double value;
+	double weight;
+	double ratio;
+};
+
+/* compare_ratio_increasing: orders the items from the smallest value per weight, for qsort
+ * parameter: first item
+ * parameter: second item
+ * returns: negative if the first one goes before, positive if after, 0 if equal
+ */
+static int compare_ratio_increasing(const void *first, const void *second)
+{
+	double ratio = ((const struct bound_item *) first)->ratio;
+	double ratio_again = ((const struct bound_item *) second)->ratio;
+	return (ratio > ratio_again) - (ratio < ratio_again);
+}
+
+/* compare_ratio_decreasing: orders the items from the biggest value per weight, for qsort
+ * parameter: first item
+ * parameter: second item
+ * returns: negative if the first one goes before, positive if after, 0 if equal
+ */
+static int compare_ratio_decreasing(const void *first, const void *second)
+{
+	return compare_ratio_increasing(second, first);
+}
+
+/* fractional_fill: fills an amount of weight with the items in an order, the last one taken in part. With the order of
+ * the value per weight it is the optimum of the linear relaxation, a bound of the integer filling
+ * parameter: items
+ * parameter: number of items
+ * parameter: amount of weight to fill
+ * parameter: order of the items, for qsort
+ * returns: the value taken
+ */
+static double fractional_fill(struct bound_item *items, int number_of_items, double amount,
+	int (*compare)(const void *, const void *))
+{
+	/* iterator */
+	int iterator_item;
+	double value = 0.0;
+	qsort(items, number_of_items, sizeof (struct bound_item), compare);
+	for (iterator_item = 0; iterator_item < number_of_items; iterator_item++)
+	{
+		if (items[iterator_item].weight <= amount)
+		{
+			value += items[iterator_item].value;
+			amount -= items[iterator_item].weight;
+		}
+		else
+		{
+			value += items[iterator_item].value * amount / items[iterator_item].weight;
+			break;
+		}
+	}
+	return value;
+}
+
+/* set_item: sets an item of a fractional filling
+ * parameter: item
+ * parameter: value
+ * parameter: weight, an item without weight goes first in the decreasing order
+ * returns: nothing, it's void
+ */
+static void set_item(struct bound_item *item, double value, double weight)
+{
+	item->value = value;
+	item->weight = weight;
+	item->ratio = weight > 0.0 ? value / weight : INFINITY;
+}
+
+/* placed_value_bound: the most revenue or QoS the virtual machines give within the capacity of the datacenter, the
+ * smallest fractional filling of the aggregated capacity of each resource
+ * parameter: datacenter instance
+ * parameter: value of each virtual machine
+ * parameter: items, one per virtual machine
+ * returns: the bound of the value of the placed virtual machines
+ */
+static double placed_value_bound(struct datacenter *datacenter, const float *value, struct bound_item *items)
+{
+	/* iterators */
+	int iterator_resource;
+	int iterator_virtual;
+	int iterator_physical;
+	double capacity;
+	double filled;
+	double bound = INFINITY;
+	for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+	{
+		capacity = 0.0;
+		for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+		{
+			capacity += datacenter->H[iterator_physical][iterator_resource];
+		}
+		for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+		{
+			set_item(&items[iterator_virtual], value[iterator_virtual], datacenter->V[iterator_virtual][iterator_resource]);
+		}
+		filled = fractional_fill(items, datacenter->v_size, capacity, compare_ratio_decreasing);
+		bound = filled < bound ? filled : bound;
+	}
+	return bound;
+}
+
+/* objective_bounds_compute: bounds the objective functions of an instance from H, V, T and K, in O(V log V + pairs):
+ * (OF1) the power of the Processor demand of the mandatory virtual machines, by a fractional filling of the physical
+ * machines from the one with the least power at full load per Processor unit, and the idle power of every physical
+ * machine plus the dynamic power of all the demand for the worst. (OF2) the traffic of the mandatory pairs too big to
+ * share the biggest physical machine, and all the traffic for the worst. (OF3) and (OF4) the fractional filling of the
+ * aggregated capacity of each resource, and the mandatory virtual machines for the worst. (OF5) the traffic a mandatory
+ * virtual machine can not keep in its physical machine loads every link of it, and all the traffic over the smallest
+ * link for the worst, within the link capacities of a feasible placement
+ * parameter: datacenter instance
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: bounds to fill
+ * returns: nothing, it's void
+ */
+void objective_bounds_compute(struct datacenter *datacenter, int max_SLA, struct objective_bounds *bounds)
+{
+	struct traffic_matrix *T = datacenter->T;
+	struct network_topology *topology = datacenter->topology;
+	int size = datacenter->v_size > datacenter->h_size ? datacenter->v_size : datacenter->h_size;
+	struct bound_item *items = (struct bound_item *) malloc ((size + 1) * sizeof (struct bound_item));
+	float *revenue = (float *) malloc ((datacenter->v_size + 1) * sizeof (float));
+	double *forced = (double *) calloc (datacenter->v_size + 1, sizeof (double));
+	/* iterators */
+	int iterator_virtual;
+	int iterator_physical;
+	int iterator_resource;
+	int iterator_pair;
+	int iterator_link;
+	int number_of_items;
+	int peer;
+	int apart;
+	int biggest[NUMBER_OF_RESOURCES] = {0, 0, 0};
+	double mandatory_cpu = 0.0;
+	double total_cpu = 0.0;
+	double mandatory_revenue = 0.0;
+	double mandatory_qos = 0.0;
+	double idle = 0.0;
+	double forced_traffic = 0.0;
+	double total_traffic = 0.0;
+	double most_forced = 0.0;
+	double smallest_link = INFINITY;
+	double host_link;
+	double widest_host = 0.0;
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+		{
+			if (datacenter->H[iterator_physical][iterator_resource] > biggest[iterator_resource])
+			{
+				biggest[iterator_resource] = datacenter->H[iterator_physical][iterator_resource];
+			}
+		}
+		idle += datacenter->power_idle[iterator_physical];
+	}
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		total_cpu += datacenter->V[iterator_virtual][0];
+		revenue[iterator_virtual] = (float) datacenter->V[iterator_virtual][4];
+		if (datacenter->V[iterator_virtual][3] == max_SLA)
+		{
+			mandatory_cpu += datacenter->V[iterator_virtual][0];
+			mandatory_revenue += datacenter->V[iterator_virtual][4];
+			mandatory_qos += datacenter->qos[iterator_virtual];
+		}
+	}
+	/* (OF1) power: at full load the power per Processor unit of a physical machine is the lowest it gets */
+	number_of_items = 0;
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		if (datacenter->H[iterator_physical][0] > 0)
+		{
+			set_item(&items[number_of_items++], datacenter->power_idle[iterator_physical] + datacenter->power_dynamic[iterator_physical],
+				datacenter->H[iterator_physical][0]);
+		}
+	}
+	bounds->ideal[0] = (float) fractional_fill(items, number_of_items, mandatory_cpu, compare_ratio_increasing);
+	number_of_items = 0;
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		if (datacenter->H[iterator_physical][0] > 0)
+		{
+			set_item(&items[number_of_items++], datacenter->power_dynamic[iterator_physical], datacenter->H[iterator_physical][0]);
+		}
+	}
+	bounds->nadir[0] = (float) (idle + fractional_fill(items, number_of_items, total_cpu, compare_ratio_decreasing));
+	/* (OF2) traffic: each pair once, the mandatory pairs too big for the biggest resources of a physical machine are apart */
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		for (iterator_pair = T->row_start[iterator_virtual]; iterator_pair < T->row_start[iterator_virtual + 1]; iterator_pair++)
+		{
+			peer = T->column[iterator_pair];
+			total_traffic += T->value[iterator_pair];
+			if (datacenter->V[iterator_virtual][3] != max_SLA || datacenter->V[peer][3] != max_SLA)
+			{
+				continue;
+			}
+			apart = 0;
+			for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+			{
+				apart |= datacenter->V[iterator_virtual][iterator_resource] + datacenter->V[peer][iterator_resource] > biggest[iterator_resource];
+			}
+			if (apart)
+			{
+				forced_traffic += T->value[iterator_pair];
+				forced[iterator_virtual] += T->value[iterator_pair];
+				forced[peer] += T->value[iterator_pair];
+			}
+		}
+	}
+	bounds->ideal[1] = (float) forced_traffic;
+	bounds->nadir[1] = (float) total_traffic;
+	/* (OF3) revenue and (OF4) QoS */
+	bounds->ideal[2] = (float) placed_value_bound(datacenter, revenue, items);
+	bounds->nadir[2] = (float) mandatory_revenue;
+	bounds->ideal[3] = (float) placed_value_bound(datacenter, datacenter->qos, items);
+	bounds->nadir[3] = (float) mandatory_qos;
+	/* (OF5) MLU: the widest physical machine is the one whose smallest link is the biggest, a physical machine without
+	 * links keeps its traffic off the network */
+	for (iterator_link = 0; iterator_link < datacenter->l_size; iterator_link++)
+	{
+		smallest_link = datacenter->K[iterator_link] < smallest_link ? datacenter->K[iterator_link] : smallest_link;
+	}
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		host_link = INFINITY;
+		for (iterator_link = topology->link_start[iterator_physical]; iterator_link < topology->link_start[iterator_physical + 1]; iterator_link++)
+		{
+			host_link = datacenter->K[topology->link[iterator_link]] < host_link ? datacenter->K[topology->link[iterator_link]] : host_link;
+		}
+		widest_host = host_link > widest_host ? host_link : widest_host;
+	}
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		most_forced = forced[iterator_virtual] > most_forced ? forced[iterator_virtual] : most_forced;
+	}
+	if (datacenter->l_size == 0)
+	{
+		/* without links the MLU is not defined, it is -1 for every placement */
+		bounds->ideal[4] = -1.0f;
+		bounds->nadir[4] = -1.0f;
+	}
+	else
+	{
+		bounds->ideal[4] = isinf(widest_host) || widest_host == 0.0 ? 0.0f : (float) (most_forced / widest_host);
+		bounds->nadir[4] = smallest_link > 0.0 ? (float) fmin(1.0, total_traffic / smallest_link) : 1.0f;
+		bounds->nadir[4] = fmaxf(bounds->nadir[4], bounds->ideal[4]);
+	}
+	free(items);
+	free(revenue);
+	free(forced);
+}
+
+/* objective_bounds_normalize: normalizes a cost by the bounds of its objective function, whatever its sense
+ * parameter: bounds of the objective functions
+ * parameter: objective function
+ * parameter: cost
+ * returns: 0 at the ideal point and 1 at the nadir point, 0 if both are the same
+ */
+float objective_bounds_normalize(const struct objective_bounds *bounds, int objective, float cost)
+{
+	float range = bounds->nadir[objective] - bounds->ideal[objective];
+	if (range == 0.0f)
+	{
+		return 0.0f;
+	}
+	return (cost - bounds->ideal[objective]) / range;
+}
+
+/* objective_bounds_gap: distance of the archive to the ideal point, the biggest over the objective functions of the
+ * normalized cost of the best member of each one
+ * parameter: bounds of the objective functions
+ * parameter: archive
+ * returns: the gap, 0 if the archive reaches the ideal point, infinity if the archive is empty
+ */
+float objective_bounds_gap(const struct objective_bounds *bounds, struct archive *archive)
+{
+	/* iterator */
+	int iterator_objective;
+	float best;
+	float gap = 0.0f;
+	struct pareto_element *element;
+	if (archive->head == NULL)
+	{
+		return INFINITY;
+	}
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		best = INFINITY;
+		for (element = archive->head; element != NULL; element = element->next)
+		{
+			best = fminf(best, objective_bounds_normalize(bounds, iterator_objective, element->costs[iterator_objective]));
+		}
+		gap = fmaxf(gap, best);
+	}
+	return gap;
+}
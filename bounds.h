@@ -0,0 +1,35 @@
+/*
+ * bounds.h: Virtual Machine Placement Problem - Ideal and Nadir Objective Bounds Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef BOUNDS_H
+#define BOUNDS_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "population.h"
+#include "datacenter.h"
+#include "archive.h"
+#include "nds.h"
+
+/* structure of the bounds of the objective functions of an instance, in the units of the costs: no placement is better
+ * than the ideal point in any objective, and no feasible placement is worse than the nadir point in any objective */
+struct objective_bounds
+{
+	float ideal[NUMBER_OF_OBJECTIVES];
+	float nadir[NUMBER_OF_OBJECTIVES];
+};
+
+/* function headers definitions */
+void objective_bounds_compute(struct datacenter *datacenter, int max_SLA, struct objective_bounds *bounds);
+float objective_bounds_normalize(const struct objective_bounds *bounds, int objective, float cost);
+float objective_bounds_gap(const struct objective_bounds *bounds, struct archive *archive);
+
+#endif
@@ -0,0 +1,318 @@
+/*
+ * capacity.c: Virtual Machine Placement Problem - Free Capacity Index
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include free capacity index header */
+#include "capacity.h"
+
+/* capacity_index_setup: fills the fields of a free capacity index that depend only on the datacenter
+ * parameter: free capacity index, with its nodes reserved
+ * parameter: datacenter instance
+ * returns: nothing, it's void
+ */
+static void capacity_index_setup(struct capacity_index *index, struct datacenter *datacenter)
+{
+	/* iterators */
+	int iterator_physical;
+	int iterator_resource;
+	int biggest;
+	index->datacenter = datacenter;
+	index->utilization = NULL;
+	for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+	{
+		biggest = 1;
+		for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+		{
+			if (datacenter->H[iterator_physical][iterator_resource] > biggest)
+			{
+				biggest = datacenter->H[iterator_physical][iterator_resource];
+			}
+		}
+		index->scale[iterator_resource] = 1.0f / biggest;
+	}
+}
+
+/* capacity_index_leaves: number of leaves of the segment tree of a datacenter
+ * parameter: datacenter instance
+ * returns: the smallest power of 2 not smaller than the number of physical machines
+ */
+static int capacity_index_leaves(struct datacenter *datacenter)
+{
+	int number_of_leaves = 1;
+	while (number_of_leaves < datacenter->h_size)
+	{
+		number_of_leaves *= 2;
+	}
+	return number_of_leaves;
+}
+
+/* capacity_index_create: reserves a free capacity index for individuals of a datacenter
+ * parameter: datacenter instance
+ * returns: free capacity index, not attached to any individual yet
+ */
+struct capacity_index * capacity_index_create(struct datacenter *datacenter)
+{
+	struct capacity_index *index = (struct capacity_index *) malloc (sizeof (struct capacity_index));
+	index->number_of_leaves = capacity_index_leaves(datacenter);
+	index->nodes = (struct capacity_node *) malloc (2 * index->number_of_leaves * sizeof (struct capacity_node));
+	capacity_index_setup(index, datacenter);
+	return index;
+}
+
+/* capacity_index_create_scratch: takes a free capacity index for individuals of a datacenter from a scratch arena,
+ * it is released with the arena instead of capacity_index_free
+ * parameter: datacenter instance
+ * parameter: scratch arena
+ * returns: free capacity index, not attached to any individual yet
+ */
+struct capacity_index * capacity_index_create_scratch(struct datacenter *datacenter, struct scratch *scratch)
+{
+	struct capacity_index *index = (struct capacity_index *) scratch_alloc (scratch, sizeof (struct capacity_index));
+	index->number_of_leaves = capacity_index_leaves(datacenter);
+	index->nodes = (struct capacity_node *) scratch_alloc (scratch, 2 * index->number_of_leaves * sizeof (struct capacity_node));
+	capacity_index_setup(index, datacenter);
+	return index;
+}
+
+/* capacity_index_free: releases a free capacity index
+ * parameter: free capacity index
+ * returns: nothing, it's void
+ */
+void capacity_index_free(struct capacity_index *index)
+{
+	if (index != NULL)
+	{
+		free(index->nodes);
+		free(index);
+	}
+}
+
+/* load_leaf: loads the residual resources of a physical machine into its leaf
+ * parameter: free capacity index, attached
+ * parameter: identificator of the physical machine
+ * returns: nothing, it's void
+ */
+static void load_leaf(struct capacity_index *index, int physical)
+{
+	struct capacity_node *leaf = index->nodes + index->number_of_leaves + physical;
+	int *capacity = index->datacenter->H[physical];
+	int *utilization = index->utilization + physical * NUMBER_OF_RESOURCES;
+	/* iterator */
+	int iterator_resource;
+	float slack = 0.0f;
+	for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+	{
+		leaf->residual[iterator_resource] = capacity[iterator_resource] - utilization[iterator_resource];
+		slack += leaf->residual[iterator_resource] * index->scale[iterator_resource];
+	}
+	leaf->minimum_slack = slack;
+	leaf->maximum_slack = slack;
+}
+
+/* merge_node: summarizes the children of a node
+ * parameter: free capacity index
+ * parameter: node
+ * returns: nothing, it's void
+ */
+static void merge_node(struct capacity_index *index, int node)
+{
+	struct capacity_node *parent = index->nodes + node;
+	struct capacity_node *left = index->nodes + 2 * node;
+	struct capacity_node *right = left + 1;
+	/* iterator */
+	int iterator_resource;
+	for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+	{
+		parent->residual[iterator_resource] = left->residual[iterator_resource] > right->residual[iterator_resource] ?
+			left->residual[iterator_resource] : right->residual[iterator_resource];
+	}
+	parent->minimum_slack = fminf(left->minimum_slack, right->minimum_slack);
+	parent->maximum_slack = fmaxf(left->maximum_slack, right->maximum_slack);
+}
+
+/* capacity_index_attach: builds the free capacity index of an individual, in O(h_size)
+ * parameter: free capacity index
+ * parameter: utilization rows of the individual, the index reads them on each update
+ * returns: nothing, it's void
+ */
+void capacity_index_attach(struct capacity_index *index, int *utilization)
+{
+	/* iterators */
+	int iterator_physical;
+	int iterator_resource;
+	int node;
+	struct capacity_node *leaf;
+	index->utilization = utilization;
+	for (iterator_physical = 0; iterator_physical < index->number_of_leaves; iterator_physical++)
+	{
+		if (iterator_physical < index->datacenter->h_size)
+		{
+			load_leaf(index, iterator_physical);
+		}
+		else
+		{
+			/* padding leaves: nothing fits in them */
+			leaf = index->nodes + index->number_of_leaves + iterator_physical;
+			for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+			{
+				leaf->residual[iterator_resource] = INT_MIN;
+			}
+			leaf->minimum_slack = INFINITY;
+			leaf->maximum_slack = -INFINITY;
+		}
+	}
+	for (node = index->number_of_leaves - 1; node >= 1; node--)
+	{
+		merge_node(index, node);
+	}
+}
+
+/* capacity_index_update: reloads a physical machine after its utilization changed, in O(log h_size)
+ * parameter: free capacity index, attached
+ * parameter: identificator of the physical machine
+ * returns: nothing, it's void
+ */
+void capacity_index_update(struct capacity_index *index, int physical)
+{
+	int node = (index->number_of_leaves + physical) / 2;
+	load_leaf(index, physical);
+	for (; node >= 1; node /= 2)
+	{
+		merge_node(index, node);
+	}
+}
+
+/* node_fits: checks if the requirements are within the biggest residuals of a node, for a leaf it means they fit
+ * parameter: node
+ * parameter: requirements of Processor, Memory and Storage
+ * returns: 1 if yes, 0 if no
+ */
+static int node_fits(struct capacity_node *node, const int *requirements)
+{
+	return node->residual[0] >= requirements[0] && node->residual[1] >= requirements[1] && node->residual[2] >= requirements[2];
+}
+
+/* capacity_index_fits: checks if a virtual machine fits in a physical machine
+ * parameter: free capacity index, attached
+ * parameter: identificator of the physical machine
+ * parameter: requirements of Processor, Memory and Storage
+ * returns: 1 if yes, 0 if no
+ */
+int capacity_index_fits(struct capacity_index *index, int physical, const int *requirements)
+{
+	return node_fits(index->nodes + index->number_of_leaves + physical, requirements);
+}
+
+/* capacity_index_slack: residual resources of a physical machine, in the units of the size of the virtual machines
+ * parameter: free capacity index, attached
+ * parameter: identificator of the physical machine
+ * returns: the residual resources normalized by the biggest capacity of each resource
+ */
+float capacity_index_slack(struct capacity_index *index, int physical)
+{
+	return index->nodes[index->number_of_leaves + physical].minimum_slack;
+}
+
+/* capacity_index_size: size of a virtual machine in the units of the slack, to sort virtual machines by size
+ * parameter: free capacity index
+ * parameter: requirements of Processor, Memory and Storage
+ * returns: the requirements normalized by the biggest capacity of each resource
+ */
+float capacity_index_size(struct capacity_index *index, const int *requirements)
+{
+	return requirements[0] * index->scale[0] + requirements[1] * index->scale[1] + requirements[2] * index->scale[2];
+}
+
+/* find_first: finds the first physical machine from a position that a virtual machine fits in
+ * parameter: free capacity index
+ * parameter: node covering the physical machines from low to high - 1
+ * parameter: first physical machine covered by the node
+ * parameter: end of the physical machines covered by the node
+ * parameter: requirements of Processor, Memory and Storage
+ * parameter: first physical machine to consider
+ * returns: the physical machine, -1 if there is none
+ */
+static int find_first(struct capacity_index *index, int node, int low, int high, const int *requirements, int start)
+{
+	int found;
+	if (high <= start || !node_fits(index->nodes + node, requirements))
+	{
+		return -1;
+	}
+	if (node >= index->number_of_leaves)
+	{
+		return node - index->number_of_leaves;
+	}
+	found = find_first(index, 2 * node, low, (low + high) / 2, requirements, start);
+	if (found < 0)
+	{
+		found = find_first(index, 2 * node + 1, (low + high) / 2, high, requirements, start);
+	}
+	return found;
+}
+
+/* find_extreme: finds the physical machine with the smallest (best fit) or biggest (worst fit) slack that a virtual
+ * machine fits in, the subtrees that can not fit it or can not improve the one found are skipped
+ * parameter: free capacity index
+ * parameter: node
+ * parameter: requirements of Processor, Memory and Storage
+ * parameter: FIT_BEST or FIT_WORST
+ * parameter: physical machine found so far, to update
+ * parameter: its slack, to update
+ * returns: nothing, it's void
+ */
+static void find_extreme(struct capacity_index *index, int node, const int *requirements, int policy, int *found, float *found_slack)
+{
+	struct capacity_node *actual = index->nodes + node;
+	int first_child;
+	if (!node_fits(actual, requirements) ||
+		(policy == FIT_BEST && actual->minimum_slack >= *found_slack) ||
+		(policy == FIT_WORST && actual->maximum_slack <= *found_slack))
+	{
+		return;
+	}
+	if (node >= index->number_of_leaves)
+	{
+		*found = node - index->number_of_leaves;
+		*found_slack = actual->minimum_slack;
+		return;
+	}
+	/* the most promising child first, so the other one is more likely skipped */
+	first_child = 2 * node;
+	if ((policy == FIT_BEST && index->nodes[2 * node + 1].minimum_slack < index->nodes[2 * node].minimum_slack) ||
+		(policy == FIT_WORST && index->nodes[2 * node + 1].maximum_slack > index->nodes[2 * node].maximum_slack))
+	{
+		first_child = 2 * node + 1;
+	}
+	find_extreme(index, first_child, requirements, policy, found, found_slack);
+	find_extreme(index, first_child ^ 1, requirements, policy, found, found_slack);
+}
+
+/* capacity_index_find: finds a physical machine a virtual machine fits in. The descent skips the subtrees without room
+ * for some resource, so it takes O(log h_size) steps unless many physical machines have room for each resource
+ * separately but not for all of them
+ * parameter: free capacity index, attached
+ * parameter: requirements of Processor, Memory and Storage
+ * parameter: FIT_FIRST, FIT_BEST for the smallest slack left or FIT_WORST for the biggest one
+ * parameter: for FIT_FIRST, the physical machine the search starts from, going around to the ones before it
+ * returns: the physical machine, -1 if the virtual machine fits in none
+ */
+int capacity_index_find(struct capacity_index *index, const int *requirements, int policy, int start)
+{
+	int found = -1;
+	float found_slack;
+	if (policy == FIT_FIRST)
+	{
+		found = find_first(index, 1, 0, index->number_of_leaves, requirements, start);
+		if (found < 0 && start > 0)
+		{
+			found = find_first(index, 1, 0, index->number_of_leaves, requirements, 0);
+		}
+		return found;
+	}
+	found_slack = policy == FIT_BEST ? INFINITY : -INFINITY;
+	find_extreme(index, 1, requirements, policy, &found, &found_slack);
+	return found;
+}
@@ -0,0 +1,59 @@
+/*
+ * capacity.h: Virtual Machine Placement Problem - Free Capacity Index Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef CAPACITY_H
+#define CAPACITY_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "population.h"
+#include "datacenter.h"
+#include "scratch.h"
+/* definitions, the policies to choose a physical machine among the ones a virtual machine fits in */
+#define FIT_FIRST 0
+#define FIT_BEST 1
+#define FIT_WORST 2
+
+/* node of the free capacity index, summarizing the physical machines below it */
+struct capacity_node
+{
+	/* biggest residual of each resource, they may come from different physical machines */
+	int residual[NUMBER_OF_RESOURCES];
+	/* smallest and biggest slack: the residual resources normalized by the biggest capacity of each resource */
+	float minimum_slack;
+	float maximum_slack;
+};
+
+/* structure of the free capacity index of one individual: a segment tree over the physical machines */
+struct capacity_index
+{
+	struct datacenter *datacenter;
+	/* utilization rows of the attached individual */
+	int *utilization;
+	/* node 1 is the root, the children of node n are 2n and 2n + 1, and physical machine p is node number_of_leaves + p */
+	int number_of_leaves;
+	struct capacity_node *nodes;
+	/* inverse of the biggest capacity of each resource */
+	float scale[NUMBER_OF_RESOURCES];
+};
+
+/* function headers definitions */
+struct capacity_index * capacity_index_create(struct datacenter *datacenter);
+struct capacity_index * capacity_index_create_scratch(struct datacenter *datacenter, struct scratch *scratch);
+void capacity_index_free(struct capacity_index *index);
+void capacity_index_attach(struct capacity_index *index, int *utilization);
+void capacity_index_update(struct capacity_index *index, int physical);
+int capacity_index_fits(struct capacity_index *index, int physical, const int *requirements);
+float capacity_index_slack(struct capacity_index *index, int physical);
+float capacity_index_size(struct capacity_index *index, const int *requirements);
+int capacity_index_find(struct capacity_index *index, const int *requirements, int policy, int start);
+
+#endif
@@ -8,102 +8,6 @@
 /* include common header */
 #include "common.h"
 
-/* get_h_size: returns the number of physical machines
- * parameter: path to the datacenter file
- * returns: number of physical machines
- */
-int get_h_size(char path_to_file[])
-{
-	/* datacenter file to read from */
-	FILE *datacenter_file;
-	/* line readed from file */
-	char input_line[TAM_BUFFER];
-	/* number of physical machines */
-	int h_size = 0;
-	/* 1 if reading the physical machines block in the file */
-	int reading_physical = 0;
- 	/* open the file for reading */ 
-	datacenter_file = fopen(path_to_file,"r");
-    /* if it is opened ok, we continue */    
-	if (datacenter_file != NULL) 
-	{ 
-		/* read until the end */
-		while(!feof(datacenter_file)) 
-		{
-			/* get line per line */
-			fgets(input_line, TAM_BUFFER, datacenter_file);
-			/* if the line is equal to H_HEADER, we begin the physical machines block in the file */
-			if (strstr(input_line,H_HEADER) != NULL)
-			{
-				reading_physical = 1;
-			}
-			/* if the line is equal to V_HEADER, we end the physical machines block in the file */
-			if (strstr(input_line,V_HEADER) != NULL) 
-			{
-				reading_physical = 0;
-				break;
-			}
-			/* if it is the correct block in the file, it is not the header and it is not a blank line, we count */			
-			if (reading_physical == 1 && strstr(input_line,H_HEADER) == NULL && strcmp(input_line, "\n") != 0)
-			{
-				h_size++;
-			}
-		}
-	}
-	/* close the file */
-	fclose(datacenter_file);
-	/* return the value */
-	return h_size;
-}
-
-/* get_v_size: returns the number of virtual machines
- * parameter: path to the datacenter file
- * returns: number of virtual machines
- */
-int get_v_size(char path_to_file[])
-{
-	/* datacenter file to read from */
-	FILE *datacenter_file;
-	/* line readed from file */
-	char input_line[TAM_BUFFER];
-	/* number of virtual machines */
-	int v_size = 0;
-	/* 1 if reading the virtual machines block in the file */
-	int reading_virtual = 0;
- 	/* open the file for reading */
-	datacenter_file = fopen(path_to_file,"r");
-    /* if it is opened ok, we continue */
-	if (datacenter_file != NULL) 
-	{ 
-		/* read until the end */
-		while(!feof(datacenter_file)) 
-		{
-			/* get line per line */
-			fgets(input_line, TAM_BUFFER, datacenter_file);
-			/* if the line is equal to V_HEADER, we begin the virtual machines block in the file */
-			if (strstr(input_line,V_HEADER) != NULL)
-			{
-				reading_virtual = 1;
-			}
-			/* if the line is equal to T_HEADER, we end the virtual machines block in the file */
-			if (strstr(input_line,T_HEADER) != NULL)
-			{
-				reading_virtual = 0;
-				break;
-			}
-			/* if we are in the correct block in the file, it is not the header and it is not a blank line, we count */
-			if (reading_virtual == 1 && strstr(input_line,V_HEADER) == NULL && strcmp(input_line, "\n") != 0)
-			{
-				v_size++;
-			}
-		}
-	}
-	/* close the file */
-	fclose(datacenter_file);
-	/* return the value */
-	return v_size;
-}
-
 /* print_int_matrix: prints on screen a integer matrix
  * parameter: matrix to print
  * parameter: number of individuals
@@ -184,186 +88,91 @@ void print_float_array(float *array, int columns)
 	}
 }
 
-/* load_H: load the values of H
- * parameter: number of physical machines
- * parameter: path to the datacenter file
- * returns: H matrix
- */
-int** load_H(int h_size, char path_to_file[])
+/* context of the utilization and objectives tasks */
+struct load_context
 {
-	/* datacenter file to read from */
-	FILE *datacenter_file;
-	/* line readed from file */
-	char input_line[TAM_BUFFER];
-	/* iterator */
-	int iterator = 0;
-	/* 1 if is reading the physical machines block in the file */
-	int reading_physical = 0;
-	/* memory reserve for h_size physical machines */
-	int **H = (int **) malloc (h_size *sizeof (int *));
- 	/* open the file for reading */ 
-	datacenter_file = fopen(path_to_file,"r");
-    /* if it is opened ok, we continue */    
-	if (datacenter_file != NULL) 
-	{ 
-		/* read until the end */
-		while(!feof(datacenter_file)) 
-		{
-			/* get line per line */
-			fgets(input_line, TAM_BUFFER, datacenter_file);
-			/* if the line is equal to H_HEADER, we begin the physical machines block in the file */
-			if (strstr(input_line,H_HEADER) != NULL)
-			{
-				reading_physical = 1;
-			}
-			/* if the line is equal to V_HEADER, we end the physical machines block in the file */
-			if (strstr(input_line,V_HEADER) != NULL) 
-			{
-				reading_physical = 0;
-				break;
-			}
-			/* if it's the correct block in the file, it is not the header and it is not a blank line, we count */			
-			if (reading_physical == 1 && strstr(input_line,H_HEADER) == NULL && strcmp(input_line, "\n") != 0)
-			{
-				/* reserve 4 columns for Processor, Memory, Storage and Power Consumption */
-				H[iterator] = (int *) malloc (4 *sizeof (int));
-				/* load on the matrix and increment iterator */
-				sscanf(input_line,"%d %d %d %d\n",&H[iterator][0],&H[iterator][1],&H[iterator][2],&H[iterator][3]);
-				iterator++;
-			}
-		}
-	}
-	fclose(datacenter_file);
-	return H;
-}
+	struct population *population;
+	int **H;
+	int **V;
+	struct traffic_matrix *T;
+	int *K;
+};
 
-/* load_V: load the values of V
- * parameter: number of virtual machines
- * parameter: path to the datacenter file
- * returns: V matrix
- */
-int** load_V(int v_size, char path_to_file[])
-{
-	/* datacenter file to read from */
-	FILE *datacenter_file;
-	/* line readed from file */
-	char input_line[TAM_BUFFER];
-	/* iterator */
-	int iterator = 0;
-	/* 1 if is reading the virtual machines block in the file */
-	int reading_virtual = 0;
-	/* memory reserve for v_size virtual machines */
-	int **V = (int **) malloc (v_size *sizeof (int *));
- 	/* open the file for reading */ 
-	datacenter_file = fopen(path_to_file,"r");
-    /* if it is opened ok, we continue */    
-	if (datacenter_file != NULL) 
-	{ 
-		/* read until the end */
-		while(!feof(datacenter_file)) 
-		{
-			/* get line per line */
-			fgets(input_line, TAM_BUFFER, datacenter_file);
-			/* if the line is equal to V_HEADER, we begin the virtual machines block in the file */
-			if (strstr(input_line,V_HEADER) != NULL)
-			{
-				reading_virtual = 1;
-			}
-			/* if the line is equal to T_HEADER, we end the virtual machines block in the file */
-			if (strstr(input_line,T_HEADER) != NULL) 
-			{
-				reading_virtual = 0;
-				break;
-			}
-			/* if it's the correct block in the file, it is not the header and it is not a blank line, we count */			
-			if (reading_virtual == 1 && strstr(input_line,V_HEADER) == NULL && strcmp(input_line, "\n") != 0)
-			{
-				/* reserve 5 columns for Processor, Memory, Storage and Economical Revenue */
-				V[iterator] = (int *) malloc (5 *sizeof (int));
-				sscanf(input_line,"%d %d %d %d %d\n",&V[iterator][0],&V[iterator][1],&V[iterator][2],&V[iterator][3],&V[iterator][4]);
-				iterator++;
-			}
-		}
-	}
-	fclose(datacenter_file);
-	return V;
-}
-
-/* load_utilization: loads the utilization of the physical machines of all the individuals
- * parameter: population matrix
- * parameter: physical machines matrix
- * parameter: virtual machines matrix
- * parameter: number of individuals
- * parameter: number of physical machines
- * parameter: number of virtual machines
- * returns: utilization tridimentional matrix
+/* load_utilization_task: loads the utilization of the physical machines of a range of individuals
+ * parameter: load context
+ * parameter: first individual
+ * parameter: end of the range of individuals
+ * parameter: thread running the task
+ * returns: nothing, it's void
  */
-int*** load_utilization(int **population, int **H, int **V, int number_of_individuals, int h_size, int v_size)
+static void load_utilization_task(void *context, int begin, int end, int thread)
 {
+	struct population *population = ((struct load_context *) context)->population;
+	int **V = ((struct load_context *) context)->V;
 	/* iterators */
 	int iterator_individual;
 	int iterator_virtual;
-	int iterator_physical;
-	/* utilization holds the physical machines utilization of Processor, Memory and Storage of every individual */
-	int ***utilization = (int ***) malloc (number_of_individuals *sizeof (int **));
+	/* genes and utilization of the current individual */
+	int *individual;
+	int *utilization;
+	int *physical;
+	/* the stage needs no scratch, so it ignores the thread running it */
+	(void) thread;
 	/* iterate on individuals */	
-	for (iterator_individual=0; iterator_individual < number_of_individuals; iterator_individual++)
+	for (iterator_individual = begin; iterator_individual < end; iterator_individual++)
 	{
-		/* requirements matrix, holds the sum of virtual machines requirements for each physical machine */
-		int **requirements = (int **) malloc (h_size *sizeof (int *));
-		/* utilization holds the physical machines utilization of Processor, Memory and Storage of every individual */
-		utilization[iterator_individual] = (int **) malloc (h_size *sizeof (int *));
-		for (iterator_physical=0; iterator_physical < h_size; iterator_physical++)
-		{
-			/* virtual machine requirements in Processor, Memory and Storage. Initialized to 0 */
-			requirements[iterator_physical] = (int *) malloc (3 *sizeof (int));
- 			requirements[iterator_physical][0] = requirements[iterator_physical][1] = requirements[iterator_physical][2] = 0;
-			/* physical machine utilization of Processor, Memory and Storage. Initialized to 0 */
-			utilization[iterator_individual][iterator_physical] = (int *) malloc (3 *sizeof (int));
-			utilization[iterator_individual][iterator_physical][0] = utilization[iterator_individual][iterator_physical][1] = 
-			utilization[iterator_individual][iterator_physical][2] = 0;
-		}
+		individual = GENES(population, iterator_individual);
+		utilization = UTILIZATION(population, iterator_individual);
+		/* physical machines utilization of Processor, Memory and Storage. Initialized to 0 */
+		memset(utilization, 0, (size_t) population->h_size * NUMBER_OF_RESOURCES * sizeof (int));
 		/* iterate on positions of an individual */
-		for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+		for (iterator_virtual = 0; iterator_virtual < population->v_size; iterator_virtual++)
 		{
 			/* if the virtual machine has a placement assigned */
-			if (population[iterator_individual][iterator_virtual] != 0)
+			if (individual[iterator_virtual] != 0)
 			{
-				/* increment the requirements of the assigned physical machine with the virtual machine requirements
+				/* increment the utilization of the assigned physical machine with the virtual machine requirements
 				of Processor, Memory and Storage */
-				requirements[population[iterator_individual][iterator_virtual]-1][0] += V[iterator_virtual][0];
-				requirements[population[iterator_individual][iterator_virtual]-1][1] += V[iterator_virtual][1];
-				requirements[population[iterator_individual][iterator_virtual]-1][2] += V[iterator_virtual][2];
+				physical = utilization + (individual[iterator_virtual]-1) * NUMBER_OF_RESOURCES;
+				physical[0] += V[iterator_virtual][0];
+				physical[1] += V[iterator_virtual][1];
+				physical[2] += V[iterator_virtual][2];
 			}
 		}
-		/* iterate on positions of an individual */
-		for (iterator_physical=0; iterator_physical < h_size; iterator_physical++)
-		{
-			/* virtual machine requirements in Processor, Memory and Storage. Initialized to 0 */
-			utilization[iterator_individual][iterator_physical][0] = requirements[iterator_physical][0];
-			utilization[iterator_individual][iterator_physical][1] = requirements[iterator_physical][1];
-			utilization[iterator_individual][iterator_physical][2] = requirements[iterator_physical][2];
-		}
 	}
-	return utilization;
 }
 
-/* load_objectives: calculate the cost of each objective of each solution
- * parameter: population matrix
- * parameter: physical machines matrix
+/* load_utilization: loads the utilization of the physical machines of all the individuals
+ * parameter: population arena, its utilization block is overwritten
  * parameter: virtual machines matrix
- * parameter: network traffic matrix
- * parameter: number of individuals
- * parameter: number of physical machines
- * parameter: number of virtual machines
- * returns: cost of each objetive matrix
+ * parameter: task pool running the individuals in parallel, NULL to run them on the calling thread
+ * returns: nothing, it's void
+ */
+void load_utilization(struct population *population, int **V, struct pool *pool)
+{
+	struct load_context context = {population, NULL, V, NULL, NULL};
+	pool_run(pool, population->number_of_individuals, POOL_AUTO_CHUNK, load_utilization_task, &context);
+}
+
+/* load_objectives_task: calculate the cost of each objective of a range of solutions
+ * parameter: load context
+ * parameter: first individual
+ * parameter: end of the range of individuals
+ * parameter: thread running the task
+ * returns: nothing, it's void
  */
-float** load_objectives(int **population, int ***utilization, int **H, int **V, int **T, int number_of_individuals, int h_size, int v_size, int *K, int **network_utilization, int l_size)
+static void load_objectives_task(void *context, int begin, int end, int thread)
 {
+	struct population *population = ((struct load_context *) context)->population;
+	int **H = ((struct load_context *) context)->H;
+	int **V = ((struct load_context *) context)->V;
+	struct traffic_matrix *T = ((struct load_context *) context)->T;
+	int *K = ((struct load_context *) context)->K;
 	/* iterators */
 	int iterator_individual;
 	int iterator_virtual2;
 	int iterator_virtual;
+	int iterator_pair;
 	int physical_position;
 	int iterator_physical;
 	int iterator_link;
@@ -372,85 +181,85 @@ float** load_objectives(int **population, int ***utilization, int **H, int **V,
 	float n_u = 0.0;
 	float k = 0.0;
 	/* count the network traffic */
-	int network_traffic;
-	int count_traffic;
+	long long network_traffic;
 	/* utility of a physical machine */
 	float utilidad;
-	/* value solution holds the cost of each solution */
-	float **value_solution = (float **) malloc (number_of_individuals *sizeof (float *));
-	for (iterator_individual = 0 ; iterator_individual < number_of_individuals; iterator_individual++)
-		value_solution[iterator_individual] = (float *) malloc (5 *sizeof (float));
+	/* rows of the current individual */
+	int *individual;
+	int *utilization;
+	long long *network_utilization;
+	/* value solution holds the cost of the current solution */
+	float *value_solution;
+	/* the stage needs no scratch, so it ignores the thread running it */
+	(void) thread;
 	/* iterate on individuals */
-	for (iterator_individual = 0; iterator_individual < number_of_individuals; iterator_individual++)
+	for (iterator_individual = begin; iterator_individual < end; iterator_individual++)
 	{
+		individual = GENES(population, iterator_individual);
+		utilization = UTILIZATION(population, iterator_individual);
+		network_utilization = NETWORK_UTILIZATION(population, iterator_individual);
+		value_solution = OBJECTIVES(population, iterator_individual);
 		power_consumption = 0.0;
-		value_solution[iterator_individual][0] = value_solution[iterator_individual][1] = value_solution[iterator_individual][2] = 
-		value_solution[iterator_individual][3] = value_solution[iterator_individual][4] = 0.0;
+		value_solution[0] = value_solution[1] = value_solution[2] = value_solution[3] = value_solution[4] = 0.0;
 
 		/* (OF1) calculate energy consumption of each solution*/
 		/* iterate on physical machines */
-		for (iterator_physical = 0 ; iterator_physical < h_size ; iterator_physical++)
+		for (iterator_physical = 0 ; iterator_physical < population->h_size ; iterator_physical++)
 		{
-			if (utilization[iterator_individual][iterator_physical][0] > 0)
+			if (utilization[iterator_physical * NUMBER_OF_RESOURCES] > 0)
 			{
 				/* calculates utility of a physical machine */
-				utilidad = (float)utilization[iterator_individual][iterator_physical][0] / H[iterator_physical][0];
+				utilidad = (float)utilization[iterator_physical * NUMBER_OF_RESOURCES] / H[iterator_physical][0];
 				/* calculates energy consumption of a physical machine */
 				power_consumption += ((float)H[iterator_physical][3] - ((float)H[iterator_physical][3]*0.01)) * utilidad + 
 				(float)H[iterator_physical][3]*0.6;
 			}
 		}
 		/* loads energy consumption of each solution */
-		value_solution[iterator_individual][0] = power_consumption;
+		value_solution[0] = power_consumption;
 
 		/* (OF2) calculate network traffic between virtual machines */
 		network_traffic = 0;
 		/* iterate on virtual machines */
-		for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++) 
+		for (iterator_virtual = 0; iterator_virtual < population->v_size; iterator_virtual++) 
 		{
-			physical_position = population[iterator_individual][iterator_virtual];
-			/* count the network traffic */
-			count_traffic = 0;
-			if (population[iterator_individual][iterator_virtual] != 0)
+			physical_position = individual[iterator_virtual];
+			if (physical_position != 0)
 			{
-				for (iterator_virtual2 = 0 ; iterator_virtual2 < v_size ; iterator_virtual2++) 
+				/* iterate only on the peers with traffic, each pair holds the traffic in both directions */
+				for (iterator_pair = T->row_start[iterator_virtual]; iterator_pair < T->row_start[iterator_virtual + 1]; iterator_pair++)
 				{
-					if (physical_position == population[iterator_individual][iterator_virtual2] || 
-						population[iterator_individual][iterator_virtual2] == 0) 
+					iterator_virtual2 = T->column[iterator_pair];
+					if (individual[iterator_virtual2] != 0 && individual[iterator_virtual2] != physical_position)
 					{
-						count_traffic = 0;
-					} 
-					else 
-					{
-						count_traffic = T[iterator_virtual][iterator_virtual2];
+						/* calculates network traffic between all virtual machines of each solution */
+						network_traffic = network_traffic + T->value[iterator_pair];
 					}
-					/* calculates network traffic between all virtual machines of each solution */
-					network_traffic = network_traffic + count_traffic;
 				}
 			}
 		}
 		/* loads the network traffic of each solution */
-		value_solution[iterator_individual][1] = (float)network_traffic;
+		value_solution[1] = (float)network_traffic;
 
 		/* (OF3) calculate revenue of each solution */
 		/* (OF4) calculate QoS of each solution */
 		/* iterate on virtual machines */
-		for (iterator_virtual = 0 ; iterator_virtual < v_size ; iterator_virtual++)
+		for (iterator_virtual = 0 ; iterator_virtual < population->v_size ; iterator_virtual++)
 		{
-			physical_position = population[iterator_individual][iterator_virtual];
+			physical_position = individual[iterator_virtual];
 			if (physical_position > 0)
 			{
 				/* loads the revenue of each solution */
-				value_solution[iterator_individual][2] += (float) V[iterator_virtual][4];
+				value_solution[2] += (float) V[iterator_virtual][4];
 				/* loads the QoS of each solution */
-				value_solution[iterator_individual][3] += (float) pow (CONSTANT,V[iterator_virtual][3]) * V[iterator_virtual][3];
+				value_solution[3] += (float) pow (CONSTANT,V[iterator_virtual][3]) * V[iterator_virtual][3];
 			}
 		}
 		/* (OF5) calculate MLU of each solution */
 		/* iterate on network link */
-		for (iterator_link = 0 ; iterator_link < l_size ; iterator_link++)
+		for (iterator_link = 0 ; iterator_link < population->l_size ; iterator_link++)
 		{
-			n_u = network_utilization[iterator_individual][iterator_link] / 1.0f;
+			n_u = network_utilization[iterator_link] / 1.0f;
 			k = K[iterator_link] / 1.0f;
 			if ((float) n_u / k > MLU)
 			{
@@ -459,10 +268,24 @@ float** load_objectives(int **population, int ***utilization, int **H, int **V,
 			}
 		}
 		/* loads the MLU of each solution */
-		value_solution[iterator_individual][4] = MLU;
+		value_solution[4] = MLU;
 		MLU = -1.0;
 		n_u = 0.0;
 		k = 0.0;
 	}
-	return value_solution;
+}
+
+/* load_objectives: calculate the cost of each objective of each solution
+ * parameter: population arena, its objectives block is overwritten
+ * parameter: physical machines matrix
+ * parameter: virtual machines matrix
+ * parameter: network traffic matrix
+ * parameter: network link capacity array
+ * parameter: task pool running the individuals in parallel, NULL to run them on the calling thread
+ * returns: nothing, it's void
+ */
+void load_objectives(struct population *population, int **H, int **V, struct traffic_matrix *T, int *K, struct pool *pool)
+{
+	struct load_context context = {population, H, V, T, K};
+	pool_run(pool, population->number_of_individuals, POOL_AUTO_CHUNK, load_objectives_task, &context);
 }
@@ -11,24 +11,20 @@
 #include <stdlib.h>
 #include <math.h>
 #include <time.h>
+/* include population arena header */
+#include "population.h"
+/* include datacenter instance header */
+#include "datacenter.h"
+/* include task pool header */
+#include "pool.h"
 /* definitions */
-#define H_HEADER "PHYSICAL MACHINES"
-#define V_HEADER "VIRTUAL MACHINES"
-#define T_HEADER "NETWORK TRAFFIC"
-#define TAM_BUFFER BUFSIZ
 #define CONSTANT 10000
 #define BIG_COST 1000000
-/* get the number of physical and virtual machines */
-int get_h_size(char path_to_file[]);
-int get_v_size(char path_to_file[]);
 /* print matrix and array */
 void print_int_matrix(int ** matrix, int rows, int columns);
 void print_float_matrix(float ** matrix, int rows, int columns);
 void print_int_array(int * array, int columns);
 void print_float_array(float * array, int columns);
-/* load datacenter physical resources and virtual requirements */
-int** load_H(int h_size, char path_to_file[]);
-int** load_V(int v_size, char path_to_file[]);
 /* load utilization of physical resources and costs of the considered objective functions */
-int*** load_utilization(int **population, int **H, int **V, int number_of_individuals, int h_size, int v_size);
-float** load_objectives(int **population, int ***utilization, int **H, int **V, int **T, int number_of_individuals, int h_size, int v_size, int * K, int ** network_utilization, int l_size);
+void load_utilization(struct population *population, int **V, struct pool *pool);
+void load_objectives(struct population *population, int **H, int **V, struct traffic_matrix *T, int * K, struct pool *pool);
@@ -0,0 +1,418 @@
+/*
+ * config.c: Virtual Machine Placement Problem - Runtime Configuration
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include runtime configuration header */
+#include "config.h"
+
+/* parse_long: parses an integer value of a key
+ * parameter: value
+ * parameter: minimum allowed
+ * parameter: parsed value to fill
+ * returns: 0 if the value is an integer of at least the minimum, -1 otherwise
+ */
+static int parse_long(const char *value, long long minimum, long long *parsed)
+{
+	char *end;
+	*parsed = strtoll(value, &end, 10);
+	return end == value || *end != '\0' || *parsed < minimum ? -1 : 0;
+}
+
+/* parse_double: parses a real value of a key
+ * parameter: value
+ * parameter: minimum allowed
+ * parameter: parsed value to fill
+ * returns: 0 if the value is a real number of at least the minimum, -1 otherwise
+ */
+static int parse_double(const char *value, double minimum, double *parsed)
+{
+	char *end;
+	*parsed = strtod(value, &end);
+	return end == value || *end != '\0' || !(*parsed >= minimum) ? -1 : 0;
+}
+
+/* trim: removes the blanks around a string in place
+ * parameter: string
+ * returns: the first not blank character of the string
+ */
+static char * trim(char *string)
+{
+	char *end;
+	while (*string == ' ' || *string == '\t')
+	{
+		string++;
+	}
+	end = string + strlen(string);
+	while (end > string && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\n' || end[-1] == '\r'))
+	{
+		*--end = '\0';
+	}
+	return string;
+}
+
+/* config_defaults: fills a configuration with the default values
+ * parameter: configuration
+ * returns: nothing, it's void
+ */
+void config_defaults(struct configuration *configuration)
+{
+	configuration->datacenter_file = NULL;
+	configuration->scenarios_file[0] = '\0';
+	configuration->seed_set_file[0] = '\0';
+	configuration->number_of_individuals = NUMBER_OF_INDIVIDUALS;
+	configuration->number_of_generations = NUMBER_OF_GENERATIONS;
+	configuration->selection_percent = SELECTION_PERCENT;
+	configuration->max_SLA = MAX_SLA;
+	configuration->archive_capacity = ARCHIVE_CAPACITY;
+	configuration->archive_truncation = ARCHIVE_TRUNCATION;
+	configuration->repair_policy = REPAIR_POLICY;
+	configuration->constructive_ratio = CONSTRUCTIVE_RATIO;
+	configuration->local_search_budget = LOCAL_SEARCH_BUDGET;
+	configuration->number_of_threads = NUMBER_OF_THREADS;
+	configuration->check_only = 0;
+	configuration->seed = 0;
+	configuration->seeded = 0;
+	configuration->deadline = 0.0;
+	configuration->max_evaluations = 0;
+	configuration->stagnation_generations = 0;
+	configuration->stagnation_tolerance = STAGNATION_TOLERANCE;
+	configuration->ideal_gap = IDEAL_GAP;
+	configuration->trace_interval = 0.0;
+}
+
+/* config_set: sets a value of the configuration, the keys are the same in the files and in the command line
+ * parameter: configuration
+ * parameter: key
+ * parameter: value
+ * returns: 0 if the key is known and the value is valid, -1 otherwise
+ */
+int config_set(struct configuration *configuration, const char *key, const char *value)
+{
+	long long integer;
+	double real;
+	if (strcmp(key, "individuals") == 0)
+	{
+		if (parse_long(value, 2, &integer) != 0)
+		{
+			return -1;
+		}
+		configuration->number_of_individuals = (int) integer;
+	}
+	else if (strcmp(key, "generations") == 0)
+	{
+		if (parse_long(value, 0, &integer) != 0)
+		{
+			return -1;
+		}
+		configuration->number_of_generations = (int) integer;
+	}
+	else if (strcmp(key, "selection") == 0)
+	{
+		if (parse_double(value, 0.0, &real) != 0 || real > 1.0)
+		{
+			return -1;
+		}
+		configuration->selection_percent = (float) real;
+	}
+	else if (strcmp(key, "max-sla") == 0)
+	{
+		if (parse_long(value, 0, &integer) != 0)
+		{
+			return -1;
+		}
+		configuration->max_SLA = (int) integer;
+	}
+	else if (strcmp(key, "archive-capacity") == 0)
+	{
+		if (parse_long(value, 0, &integer) != 0)
+		{
+			return -1;
+		}
+		configuration->archive_capacity = (int) integer;
+	}
+	else if (strcmp(key, "truncation") == 0)
+	{
+		if (strcmp(value, "epsilon") == 0)
+		{
+			configuration->archive_truncation = ARCHIVE_TRUNCATE_EPSILON;
+		}
+		else if (strcmp(value, "crowding") == 0)
+		{
+			configuration->archive_truncation = ARCHIVE_TRUNCATE_CROWDING;
+		}
+		else if (strcmp(value, "hypervolume") == 0)
+		{
+			configuration->archive_truncation = ARCHIVE_TRUNCATE_HYPERVOLUME;
+		}
+		else
+		{
+			return -1;
+		}
+	}
+	else if (strcmp(key, "repair") == 0)
+	{
+		if (strcmp(value, "first") == 0)
+		{
+			configuration->repair_policy = FIT_FIRST;
+		}
+		else if (strcmp(value, "best") == 0)
+		{
+			configuration->repair_policy = FIT_BEST;
+		}
+		else if (strcmp(value, "worst") == 0)
+		{
+			configuration->repair_policy = FIT_WORST;
+		}
+		else
+		{
+			return -1;
+		}
+	}
+	else if (strcmp(key, "constructive") == 0)
+	{
+		if (parse_double(value, 0.0, &real) != 0 || real > 1.0)
+		{
+			return -1;
+		}
+		configuration->constructive_ratio = (float) real;
+	}
+	else if (strcmp(key, "local-search") == 0)
+	{
+		if (parse_long(value, 0, &integer) != 0)
+		{
+			return -1;
+		}
+		configuration->local_search_budget = (int) integer;
+	}
+	else if (strcmp(key, "threads") == 0)
+	{
+		if (parse_long(value, 0, &integer) != 0)
+		{
+			return -1;
+		}
+		configuration->number_of_threads = (int) integer;
+	}
+	else if (strcmp(key, "check-only") == 0)
+	{
+		if (parse_long(value, 0, &integer) != 0 || integer > 1)
+		{
+			return -1;
+		}
+		configuration->check_only = (int) integer;
+	}
+	else if (strcmp(key, "seed") == 0)
+	{
+		if (parse_long(value, 0, &integer) != 0)
+		{
+			return -1;
+		}
+		configuration->seed = (unsigned long long) integer;
+		configuration->seeded = 1;
+	}
+	else if (strcmp(key, "scenarios") == 0)
+	{
+		if (*value == '\0' || strlen(value) >= CONFIG_LINE_SIZE)
+		{
+			return -1;
+		}
+		strcpy(configuration->scenarios_file, value);
+	}
+	else if (strcmp(key, "seed-set") == 0)
+	{
+		if (*value == '\0' || strlen(value) >= CONFIG_LINE_SIZE)
+		{
+			return -1;
+		}
+		strcpy(configuration->seed_set_file, value);
+	}
+	else if (strcmp(key, "deadline-ms") == 0)
+	{
+		if (parse_double(value, 0.0, &real) != 0)
+		{
+			return -1;
+		}
+		configuration->deadline = real;
+	}
+	else if (strcmp(key, "max-evaluations") == 0)
+	{
+		if (parse_long(value, 0, &integer) != 0)
+		{
+			return -1;
+		}
+		configuration->max_evaluations = integer;
+	}
+	else if (strcmp(key, "stagnation") == 0)
+	{
+		if (parse_long(value, 0, &integer) != 0)
+		{
+			return -1;
+		}
+		configuration->stagnation_generations = (int) integer;
+	}
+	else if (strcmp(key, "stagnation-tolerance") == 0)
+	{
+		if (parse_double(value, 0.0, &real) != 0)
+		{
+			return -1;
+		}
+		configuration->stagnation_tolerance = real;
+	}
+	else if (strcmp(key, "ideal-gap") == 0)
+	{
+		if (parse_double(value, 0.0, &real) != 0)
+		{
+			return -1;
+		}
+		configuration->ideal_gap = real;
+	}
+	else if (strcmp(key, "trace-ms") == 0)
+	{
+		if (parse_double(value, 0.0, &real) != 0)
+		{
+			return -1;
+		}
+		configuration->trace_interval = real;
+	}
+	else
+	{
+		return -1;
+	}
+	return 0;
+}
+
+/* config_load_file: sets the values of a configuration file, one "key = value" per line, # starts a comment
+ * parameter: configuration
+ * parameter: path to the configuration file
+ * returns: 0 if every line is valid, -1 otherwise
+ */
+int config_load_file(struct configuration *configuration, const char *path)
+{
+	FILE *config_file;
+	char input_line[CONFIG_LINE_SIZE];
+	char *key;
+	char *value;
+	char *separator;
+	int line = 0;
+	config_file = fopen(path, "r");
+	if (config_file == NULL)
+	{
+		printf("[ERROR] can not open the configuration file %s\n", path);
+		return -1;
+	}
+	while (fgets(input_line, CONFIG_LINE_SIZE, config_file) != NULL)
+	{
+		line++;
+		if ((separator = strchr(input_line, '#')) != NULL)
+		{
+			*separator = '\0';
+		}
+		key = trim(input_line);
+		if (*key == '\0')
+		{
+			continue;
+		}
+		separator = strchr(key, '=');
+		if (separator == NULL)
+		{
+			printf("[ERROR] %s:%d: expected key = value\n", path, line);
+			fclose(config_file);
+			return -1;
+		}
+		*separator = '\0';
+		value = trim(separator + 1);
+		key = trim(key);
+		if (config_set(configuration, key, value) != 0)
+		{
+			printf("[ERROR] %s:%d: invalid setting %s = %s\n", path, line, key, value);
+			fclose(config_file);
+			return -1;
+		}
+	}
+	fclose(config_file);
+	return 0;
+}
+
+/* config_parse_arguments: fills a configuration from the command line: the datacenter file, an optional seed,
+ * and "--key value" flags; a "--config file" is applied first so the other flags override it
+ * parameter: configuration, with its default values
+ * parameter: number of arguments
+ * parameter: arguments
+ * returns: 0 if the command line is valid, -1 otherwise
+ */
+int config_parse_arguments(struct configuration *configuration, int argc, char *argv[])
+{
+	/* iterator */
+	int iterator_argument;
+	for (iterator_argument = 1; iterator_argument < argc - 1; iterator_argument++)
+	{
+		if (strcmp(argv[iterator_argument], "--config") == 0 && config_load_file(configuration, argv[iterator_argument + 1]) != 0)
+		{
+			return -1;
+		}
+	}
+	for (iterator_argument = 1; iterator_argument < argc; iterator_argument++)
+	{
+		if (strncmp(argv[iterator_argument], "--", 2) == 0)
+		{
+			if (iterator_argument + 1 == argc)
+			{
+				printf("[ERROR] missing value of %s\n", argv[iterator_argument]);
+				return -1;
+			}
+			if (strcmp(argv[iterator_argument], "--config") != 0 &&
+				config_set(configuration, argv[iterator_argument] + 2, argv[iterator_argument + 1]) != 0)
+			{
+				printf("[ERROR] invalid option %s %s\n", argv[iterator_argument], argv[iterator_argument + 1]);
+				return -1;
+			}
+			iterator_argument++;
+		}
+		else if (configuration->datacenter_file == NULL)
+		{
+			configuration->datacenter_file = argv[iterator_argument];
+		}
+		else if (config_set(configuration, "seed", argv[iterator_argument]) != 0)
+		{
+			printf("[ERROR] invalid seed %s\n", argv[iterator_argument]);
+			return -1;
+		}
+	}
+	if (configuration->datacenter_file == NULL)
+	{
+		return -1;
+	}
+	if (configuration->number_of_generations == 0 && configuration->deadline == 0.0 &&
+		configuration->max_evaluations == 0 && configuration->stagnation_generations == 0)
+	{
+		printf("[ERROR] generations 0 needs a deadline-ms, max-evaluations or stagnation budget\n");
+		return -1;
+	}
+	if (!configuration->seeded)
+	{
+		configuration->seed = (unsigned long long) time(NULL);
+	}
+	return 0;
+}
+
+/* config_usage: prints the command line usage
+ * parameter: name of the program
+ * returns: nothing, it's void
+ */
+void config_usage(const char *program)
+{
+	printf("[ERROR] usage: %s datacenter_file [seed] [--config file] [--key value ...]\n", program);
+	printf("keys: individuals, generations (0 for no limit), selection, max-sla, archive-capacity (0 for no limit),\n");
+	printf("      truncation (epsilon, crowding or hypervolume), repair (first, best or worst fit), threads (0 for every core), seed,\n");
+	printf("      constructive (fraction of the initial population built by first fit, best fit, power and traffic aware heuristics,\n");
+	printf("      0 keeps it random),\n");
+	printf("      local-search (virtual machine moves of each individual, 0 disables it),\n");
+	printf("      deadline-ms, max-evaluations, stagnation (generations), stagnation-tolerance,\n");
+	printf("      ideal-gap (stops when the best of each objective is within this fraction of the ideal to nadir range),\n");
+	printf("      scenarios (scenario stream to replay online, the budgets apply to each time step),\n");
+	printf("      seed-set (Pareto set file of a previous run seeding the initial population),\n");
+	printf("      trace-ms (milliseconds between the samples of the known Pareto front of a static run written to\n");
+	printf("      results/convergence_trace, 0 disables it),\n");
+	printf("      check-only (1 reports the feasibility check and the objective bounds of the instance and exits with its reason)\n");
+}
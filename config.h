@@ -0,0 +1,80 @@
+/*
+ * config.h: Virtual Machine Placement Problem - Runtime Configuration Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "archive.h"
+#include "pool.h"
+#include "capacity.h"
+/* definitions, the default values of the configuration */
+#define NUMBER_OF_INDIVIDUALS 100
+#define NUMBER_OF_GENERATIONS 1
+#define SELECTION_PERCENT 0.5
+#define MAX_SLA 1
+#define ARCHIVE_CAPACITY 200
+#define ARCHIVE_TRUNCATION ARCHIVE_TRUNCATE_CROWDING
+#define REPAIR_POLICY FIT_BEST
+#define CONSTRUCTIVE_RATIO 0.0
+#define LOCAL_SEARCH_BUDGET 64
+#define NUMBER_OF_THREADS POOL_ALL_CORES
+#define STAGNATION_TOLERANCE 1e-4
+#define IDEAL_GAP 0.0
+#define CONFIG_LINE_SIZE 1024
+
+/* structure of the configuration of a run, 0 disables a limit */
+struct configuration
+{
+	/* datacenter infrastructure file */
+	char *datacenter_file;
+	/* scenario stream replayed by the online dynamic mode, empty for a single static placement */
+	char scenarios_file[CONFIG_LINE_SIZE];
+	/* Pareto set file of a previous run seeding P_0, empty for a random P_0 */
+	char seed_set_file[CONFIG_LINE_SIZE];
+	/* algorithm parameters */
+	int number_of_individuals;
+	int number_of_generations;
+	float selection_percent;
+	int max_SLA;
+	int archive_capacity;
+	int archive_truncation;
+	int repair_policy;
+	/* fraction of P_0 built by the constructive heuristics, the rest of it is random */
+	float constructive_ratio;
+	/* virtual machine moves of the local search of each individual, 0 disables it */
+	int local_search_budget;
+	int number_of_threads;
+	/* only the feasibility check of the instance is run, its reason is the exit state */
+	int check_only;
+	/* seed of the random numbers, the actual time if it is not seeded */
+	unsigned long long seed;
+	int seeded;
+	/* budgets: wall clock deadline in milliseconds, evaluated individuals and generations without hypervolume gain */
+	double deadline;
+	long long max_evaluations;
+	int stagnation_generations;
+	double stagnation_tolerance;
+	/* normalized distance of the archive to the ideal point that stops the run, 0 disables it */
+	double ideal_gap;
+	/* milliseconds between the samples of the archive written to the convergence trace, 0 disables it */
+	double trace_interval;
+};
+
+/* function headers definitions */
+void config_defaults(struct configuration *configuration);
+int config_set(struct configuration *configuration, const char *key, const char *value);
+int config_load_file(struct configuration *configuration, const char *path);
+int config_parse_arguments(struct configuration *configuration, int argc, char *argv[]);
+void config_usage(const char *program);
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * datacenter.h: Virtual Machine Placement Problem - Datacenter Instance Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef DATACENTER_H
+#define DATACENTER_H
+
+/* include libraries */
+#include <limits.h>
+#include <stddef.h>
+/* compact type of the traffic exchanged by a pair of virtual machines */
+typedef unsigned int traffic_t;
+#define MAX_TRAFFIC INT_MAX
+
+/* structure of the network traffic matrix: T + T' stored as a sparse upper triangle in CSR format */
+struct traffic_matrix
+{
+	int v_size;
+	/* number of pairs of virtual machines with traffic between them */
+	int number_of_pairs;
+	/* pairs (virtual, column[pair]) with virtual < column[pair], for row_start[virtual] <= pair < row_start[virtual + 1] */
+	int *row_start;
+	int *column;
+	traffic_t *value;
+	/* the same pairs indexed by column, to reach the peers with a smaller identificator */
+	int *column_start;
+	int *row;
+	traffic_t *column_value;
+};
+
+/* structure of the network topology: the links used by each physical machine, as read from G */
+struct network_topology
+{
+	int h_size;
+	int l_size;
+	/* sorted links used by physical machine p: link[link_start[p]] to link[link_start[p + 1] - 1] */
+	int *link_start;
+	int *link;
+	/* pairs (p, shared_physical[pair]) with p < shared_physical[pair] that use at least one common link,
+	 * for shared_start[p] <= pair < shared_start[p + 1], sorted by shared_physical */
+	int *shared_start;
+	int *shared_physical;
+};
+
+/* structure of a datacenter instance, as loaded from the datacenter infrastructure file */
+struct datacenter
+{
+	/* number of physical machines, virtual machines and network links */
+	int h_size;
+	int v_size;
+	int l_size;
+	/* physical machines resources: Processor, Memory, Storage and Power Consumption */
+	int **H;
+	/* virtual machines requirements: Processor, Memory, Storage, SLA and Economical Revenue */
+	int **V;
+	/* network traffic between virtual machines */
+	struct traffic_matrix *T;
+	/* network topology: links used by each physical machine */
+	struct network_topology *topology;
+	/* network link capacities */
+	int *K;
+	/* derived tables: QoS of each virtual machine, idle and dynamic power consumption of each physical machine */
+	float *qos;
+	double *power_idle;
+	double *power_dynamic;
+	/* binary instance file the tables point into, NULL if they were allocated */
+	void *mapping;
+	size_t mapping_size;
+};
+
+#endif
@@ -0,0 +1,319 @@
+/*
+ * dynamic.c: Virtual Machine Placement Problem - Online Dynamic Scenarios
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include online dynamic scenarios header */
+#include "dynamic.h"
+#include "common.h"
+#include "network.h"
+
+/* parse_column: parses the next value of a request line
+ * parameter: position in the line, moved after the value
+ * parameter: parsed value to fill
+ * parameter: 1 if the value must be an integer, 0 for a real value
+ * returns: 0 if there is a non negative value of the kind, -1 otherwise
+ */
+static int parse_column(char **position, double *value, int integer)
+{
+	char *end;
+	*value = strtod(*position, &end);
+	if (end == *position || (*end != '\0' && *end != ' ' && *end != '\t' && *end != '\r' && *end != '\n') ||
+		!(*value >= 0.0) || (integer && (*value != floor(*value) || *value > INT_MAX)))
+	{
+		return -1;
+	}
+	*position = end;
+	return 0;
+}
+
+/* parse_request: parses a request line: time, service, datacenter, virtual machine, Processor, Memory and Storage,
+ * their percents in use, economical revenue, SLA, and the initial and final time of the virtual machine
+ * parameter: line
+ * parameter: request to fill
+ * returns: 1 for a request, 0 for a blank line, -1 if the line is not valid
+ */
+static int parse_request(char *input_line, struct scenario_request *request)
+{
+	/* iterator */
+	int iterator_column;
+	double columns[SCENARIO_COLUMNS];
+	/* the columns that are integers, the others are real */
+	static const int integer[SCENARIO_COLUMNS] = {1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1};
+	char *position = input_line;
+	while (*position == ' ' || *position == '\t' || *position == '\r' || *position == '\n')
+	{
+		position++;
+	}
+	if (*position == '\0')
+	{
+		return 0;
+	}
+	for (iterator_column = 0; iterator_column < SCENARIO_COLUMNS; iterator_column++)
+	{
+		if (parse_column(&position, &columns[iterator_column], integer[iterator_column]) != 0)
+		{
+			return -1;
+		}
+	}
+	while (*position == ' ' || *position == '\t' || *position == '\r' || *position == '\n')
+	{
+		position++;
+	}
+	if (*position != '\0')
+	{
+		return -1;
+	}
+	request->time = (int) columns[0];
+	request->service = (int) columns[1];
+	request->datacenter = (int) columns[2];
+	request->virtual = (int) columns[3];
+	for (iterator_column = 0; iterator_column < NUMBER_OF_RESOURCES; iterator_column++)
+	{
+		request->resources[iterator_column] = (int) columns[4 + iterator_column];
+		request->usage[iterator_column] = (float) columns[4 + NUMBER_OF_RESOURCES + iterator_column];
+	}
+	request->revenue = (float) columns[10];
+	request->SLA = (int) columns[11];
+	request->time_init = (int) columns[12];
+	request->time_end = (int) columns[13];
+	return 1;
+}
+
+/* scenario_load: loads a scenario stream, one request per line after the SCENARIOS header, sorted by time.
+ * A virtual machine is alive at the time steps it is requested at, and each time step holds all the virtual machines
+ * alive at it, so the ones missing from a time step have left the datacenter
+ * parameter: path to the scenario file
+ * parameter: scenario stream to fill
+ * returns: 0 if the file is valid, -1 after printing the line of the first error otherwise
+ */
+int scenario_load(const char *path_to_file, struct scenario *scenario)
+{
+	FILE *scenario_file;
+	char input_line[SCENARIO_LINE_SIZE];
+	struct scenario_request request;
+	/* iterators */
+	int iterator_request;
+	int iterator_step;
+	int line = 0;
+	int capacity = 1024;
+	int parsed = 0;
+	/* last step each virtual machine was requested at, to find the repeated ones */
+	int *last_step;
+	memset(scenario, 0, sizeof (struct scenario));
+	scenario_file = fopen(path_to_file, "r");
+	if (scenario_file == NULL)
+	{
+		printf("[ERROR] can not open the scenario file %s\n", path_to_file);
+		return -1;
+	}
+	scenario->requests = (struct scenario_request *) malloc (capacity * sizeof (struct scenario_request));
+	scenario->step_start = (int *) malloc ((capacity + 1) * sizeof (int));
+	while (fgets(input_line, SCENARIO_LINE_SIZE, scenario_file) != NULL)
+	{
+		line++;
+		if (scenario->number_of_requests == 0 && strncmp(input_line, SCENARIO_HEADER, strlen(SCENARIO_HEADER)) == 0)
+		{
+			continue;
+		}
+		parsed = parse_request(input_line, &request);
+		if (parsed < 0)
+		{
+			printf("[ERROR] %s:%d: expected %d non negative values per request\n", path_to_file, line, SCENARIO_COLUMNS);
+			break;
+		}
+		if (parsed == 0)
+		{
+			continue;
+		}
+		if (scenario->number_of_requests > 0 && request.time < scenario->requests[scenario->number_of_requests - 1].time)
+		{
+			printf("[ERROR] %s:%d: request at time %d after time %d, the requests must be sorted by time\n",
+				path_to_file, line, request.time, scenario->requests[scenario->number_of_requests - 1].time);
+			parsed = -1;
+			break;
+		}
+		if (scenario->number_of_requests == capacity)
+		{
+			capacity *= 2;
+			scenario->requests = (struct scenario_request *) realloc (scenario->requests, capacity * sizeof (struct scenario_request));
+			scenario->step_start = (int *) realloc (scenario->step_start, (capacity + 1) * sizeof (int));
+		}
+		/* a new time starts a new step */
+		if (scenario->number_of_requests == 0 || request.time != scenario->requests[scenario->number_of_requests - 1].time)
+		{
+			scenario->step_start[scenario->number_of_steps++] = scenario->number_of_requests;
+		}
+		if (request.virtual >= scenario->number_of_virtuals)
+		{
+			scenario->number_of_virtuals = request.virtual + 1;
+		}
+		scenario->requests[scenario->number_of_requests++] = request;
+	}
+	fclose(scenario_file);
+	if (parsed >= 0 && scenario->number_of_requests == 0)
+	{
+		printf("[ERROR] %s: no requests\n", path_to_file);
+		parsed = -1;
+	}
+	if (parsed < 0)
+	{
+		scenario_free(scenario);
+		return -1;
+	}
+	scenario->step_start[scenario->number_of_steps] = scenario->number_of_requests;
+	/* a virtual machine is requested once per step */
+	last_step = (int *) malloc (scenario->number_of_virtuals * sizeof (int));
+	memset(last_step, -1, scenario->number_of_virtuals * sizeof (int));
+	for (iterator_step = 0; iterator_step < scenario->number_of_steps; iterator_step++)
+	{
+		for (iterator_request = scenario->step_start[iterator_step]; iterator_request < scenario->step_start[iterator_step + 1]; iterator_request++)
+		{
+			if (last_step[scenario->requests[iterator_request].virtual] == iterator_step)
+			{
+				printf("[ERROR] %s: virtual machine %d is requested twice at time %d\n", path_to_file,
+					scenario->requests[iterator_request].virtual, scenario->requests[iterator_request].time);
+				free(last_step);
+				scenario_free(scenario);
+				return -1;
+			}
+			last_step[scenario->requests[iterator_request].virtual] = iterator_step;
+		}
+	}
+	free(last_step);
+	return 0;
+}
+
+/* scenario_free: releases a scenario stream
+ * parameter: scenario stream
+ * returns: nothing, it's void
+ */
+void scenario_free(struct scenario *scenario)
+{
+	free(scenario->requests);
+	free(scenario->step_start);
+	memset(scenario, 0, sizeof (struct scenario));
+}
+
+/* scenario_time: time of a step of a scenario stream
+ * parameter: scenario stream
+ * parameter: step
+ * returns: time of the requests of the step
+ */
+int scenario_time(struct scenario *scenario, int step)
+{
+	return scenario->requests[scenario->step_start[step]].time;
+}
+
+/* scenario_instance: builds the datacenter instance of a step: its virtual machines are the ones alive at the step,
+ * and the physical machines, the network topology and the link capacities are shared with the datacenter.
+ * The scenario stream has no network traffic, the traffic between two virtual machines is the one of the virtual
+ * machines with the same identificators in the datacenter, if it has them
+ * parameter: scenario stream
+ * parameter: step
+ * parameter: datacenter instance holding the infrastructure
+ * parameter: instance to fill, released with scenario_instance_free
+ * parameter: identificator of each virtual machine of the instance, to fill, with room for all of them
+ * returns: nothing, it's void
+ */
+void scenario_instance(struct scenario *scenario, int step, struct datacenter *datacenter, struct datacenter *instance, int *virtual_id)
+{
+	/* iterators */
+	int iterator_virtual;
+	int iterator_resource;
+	int iterator_pair;
+	int number_of_entries = 0;
+	int v_size = scenario->step_start[step + 1] - scenario->step_start[step];
+	struct scenario_request *request = scenario->requests + scenario->step_start[step];
+	/* virtual machine of the instance for each identificator, -1 if it is not alive */
+	int *instance_virtual = (int *) malloc (scenario->number_of_virtuals * sizeof (int));
+	int *V_table = (int *) malloc ((v_size + 1) * 5 * sizeof (int));
+	int *rows;
+	int *columns;
+	int *values;
+	int peer;
+	memset(instance_virtual, -1, scenario->number_of_virtuals * sizeof (int));
+	memset(instance, 0, sizeof (struct datacenter));
+	instance->h_size = datacenter->h_size;
+	instance->v_size = v_size;
+	instance->l_size = datacenter->l_size;
+	instance->H = datacenter->H;
+	instance->topology = datacenter->topology;
+	instance->K = datacenter->K;
+	instance->power_idle = datacenter->power_idle;
+	instance->power_dynamic = datacenter->power_dynamic;
+	/* virtual machines requirements: the resources in use, SLA and economical revenue */
+	instance->V = (int **) malloc ((v_size + 1) * sizeof (int *));
+	instance->V[0] = V_table;
+	instance->qos = (float *) malloc ((v_size + 1) * sizeof (float));
+	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	{
+		instance->V[iterator_virtual] = V_table + iterator_virtual * 5;
+		for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+		{
+			instance->V[iterator_virtual][iterator_resource] =
+				(int) ceil (request[iterator_virtual].resources[iterator_resource] * request[iterator_virtual].usage[iterator_resource] / 100.0);
+		}
+		instance->V[iterator_virtual][3] = request[iterator_virtual].SLA;
+		instance->V[iterator_virtual][4] = (int) lround (request[iterator_virtual].revenue * SCENARIO_REVENUE_SCALE);
+		instance->qos[iterator_virtual] = (float) pow (CONSTANT, instance->V[iterator_virtual][3]) * instance->V[iterator_virtual][3];
+		virtual_id[iterator_virtual] = request[iterator_virtual].virtual;
+		instance_virtual[request[iterator_virtual].virtual] = iterator_virtual;
+	}
+	/* network traffic between the alive virtual machines known by the datacenter */
+	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	{
+		if (virtual_id[iterator_virtual] < datacenter->v_size)
+		{
+			number_of_entries += datacenter->T->row_start[virtual_id[iterator_virtual] + 1] - datacenter->T->row_start[virtual_id[iterator_virtual]];
+		}
+	}
+	rows = (int *) malloc ((number_of_entries + 1) * sizeof (int));
+	columns = (int *) malloc ((number_of_entries + 1) * sizeof (int));
+	values = (int *) malloc ((number_of_entries + 1) * sizeof (int));
+	number_of_entries = 0;
+	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	{
+		if (virtual_id[iterator_virtual] >= datacenter->v_size)
+		{
+			continue;
+		}
+		for (iterator_pair = datacenter->T->row_start[virtual_id[iterator_virtual]];
+			iterator_pair < datacenter->T->row_start[virtual_id[iterator_virtual] + 1]; iterator_pair++)
+		{
+			peer = datacenter->T->column[iterator_pair];
+			if (peer < scenario->number_of_virtuals && instance_virtual[peer] >= 0)
+			{
+				rows[number_of_entries] = iterator_virtual;
+				columns[number_of_entries] = instance_virtual[peer];
+				values[number_of_entries] = datacenter->T->value[iterator_pair];
+				number_of_entries++;
+			}
+		}
+	}
+	instance->T = traffic_matrix_build(v_size, number_of_entries, rows, columns, values);
+	free(rows);
+	free(columns);
+	free(values);
+	free(instance_virtual);
+}
+
+/* scenario_instance_free: releases the tables of a step instance, the shared ones are kept
+ * parameter: instance filled by scenario_instance
+ * returns: nothing, it's void
+ */
+void scenario_instance_free(struct datacenter *instance)
+{
+	if (instance->V != NULL)
+	{
+		free(instance->V[0]);
+		free(instance->V);
+	}
+	if (instance->T != NULL)
+	{
+		traffic_matrix_free(instance->T);
+	}
+	free(instance->qos);
+	memset(instance, 0, sizeof (struct datacenter));
+}
@@ -0,0 +1,62 @@
+/*
+ * dynamic.h: Virtual Machine Placement Problem - Online Dynamic Scenarios Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef DYNAMIC_H
+#define DYNAMIC_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "population.h"
+#include "datacenter.h"
+/* definitions */
+#define SCENARIO_HEADER "SCENARIOS"
+#define SCENARIO_COLUMNS 14
+#define SCENARIO_LINE_SIZE 1024
+/* the economical revenue of the requests is real, the virtual machines requirements keep it in hundredths */
+#define SCENARIO_REVENUE_SCALE 100
+
+/* structure of a request of a scenario stream: a virtual machine alive at a time step */
+struct scenario_request
+{
+	int time;
+	int service;
+	int datacenter;
+	int virtual;
+	/* requirements of Processor, Memory and Storage, and the percent of them in use */
+	int resources[NUMBER_OF_RESOURCES];
+	float usage[NUMBER_OF_RESOURCES];
+	float revenue;
+	int SLA;
+	/* lifetime of the virtual machine */
+	int time_init;
+	int time_end;
+};
+
+/* structure of a scenario stream: the requests sorted by time step */
+struct scenario
+{
+	int number_of_requests;
+	struct scenario_request *requests;
+	/* requests of step s: requests[step_start[s]] to requests[step_start[s + 1] - 1], all of them at the same time */
+	int number_of_steps;
+	int *step_start;
+	/* the biggest identificator of a virtual machine plus one */
+	int number_of_virtuals;
+};
+
+/* function headers definitions */
+int scenario_load(const char *path_to_file, struct scenario *scenario);
+void scenario_free(struct scenario *scenario);
+int scenario_time(struct scenario *scenario, int step);
+void scenario_instance(struct scenario *scenario, int step, struct datacenter *datacenter, struct datacenter *instance, int *virtual_id);
+void scenario_instance_free(struct datacenter *instance);
+
+#endif
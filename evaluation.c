@@ -0,0 +1,373 @@
+/*
+ * evaluation.c: Virtual Machine Placement Problem - Incremental Evaluation
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include incremental evaluation header */
+#include "evaluation.h"
+#include "common.h"
+
+/* evaluation_create: reserves an evaluation state for individuals of a datacenter
+ * parameter: datacenter instance
+ * returns: evaluation state, not attached to any individual yet
+ */
+struct evaluation * evaluation_create(struct datacenter *datacenter)
+{
+	struct evaluation *evaluation = (struct evaluation *) malloc (sizeof (struct evaluation));
+	evaluation->datacenter = datacenter;
+	evaluation->genes = NULL;
+	evaluation->utilization = NULL;
+	evaluation->network_utilization = NULL;
+	/* scratch space for the traffic moved between physical machines, kept clean between moves */
+	evaluation->traffic_removed = (long long *) calloc (datacenter->h_size, sizeof (long long));
+	evaluation->traffic_added = (long long *) calloc (datacenter->h_size, sizeof (long long));
+	evaluation->touched_physical = (int *) malloc (datacenter->h_size *sizeof (int));
+	return evaluation;
+}
+
+/* evaluation_create_scratch: takes an evaluation state for individuals of a datacenter from a scratch arena,
+ * it is released with the arena instead of evaluation_free
+ * parameter: datacenter instance
+ * parameter: scratch arena
+ * returns: evaluation state, not attached to any individual yet
+ */
+struct evaluation * evaluation_create_scratch(struct datacenter *datacenter, struct scratch *scratch)
+{
+	struct evaluation *evaluation = (struct evaluation *) scratch_alloc (scratch, sizeof (struct evaluation));
+	evaluation->datacenter = datacenter;
+	evaluation->genes = NULL;
+	evaluation->utilization = NULL;
+	evaluation->network_utilization = NULL;
+	/* scratch space for the traffic moved between physical machines, kept clean between moves */
+	evaluation->traffic_removed = (long long *) scratch_alloc (scratch, datacenter->h_size * sizeof (long long));
+	evaluation->traffic_added = (long long *) scratch_alloc (scratch, datacenter->h_size * sizeof (long long));
+	evaluation->touched_physical = (int *) scratch_alloc (scratch, datacenter->h_size *sizeof (int));
+	memset(evaluation->traffic_removed, 0, datacenter->h_size * sizeof (long long));
+	memset(evaluation->traffic_added, 0, datacenter->h_size * sizeof (long long));
+	return evaluation;
+}
+
+/* evaluation_free: releases an evaluation state
+ * parameter: evaluation state
+ * returns: nothing, it's void
+ */
+void evaluation_free(struct evaluation *evaluation)
+{
+	if (evaluation != NULL)
+	{
+		free(evaluation->traffic_removed);
+		free(evaluation->traffic_added);
+		free(evaluation->touched_physical);
+		free(evaluation);
+	}
+}
+
+/* physical_power_consumption: calculates the energy consumption of a physical machine
+ * parameter: datacenter instance
+ * parameter: identificator of the physical machine
+ * parameter: Processor utilization of the physical machine
+ * returns: energy consumption, 0 if the physical machine is turned off
+ */
+double physical_power_consumption(struct datacenter *datacenter, int physical, int cpu_utilization)
+{
+	/* utility of the physical machine */
+	double utilidad;
+	if (cpu_utilization <= 0)
+	{
+		return 0.0;
+	}
+	utilidad = (double) cpu_utilization / datacenter->H[physical][0];
+	return datacenter->power_dynamic[physical] * utilidad + datacenter->power_idle[physical];
+}
+
+/* load_MLU: recalculates the maximum link utilization of the attached individual
+ * parameter: evaluation state
+ * returns: nothing, it's void
+ */
+static void load_MLU(struct evaluation *evaluation)
+{
+	/* iterator */
+	int iterator_link;
+	float link_utilization;
+	evaluation->MLU = -1.0;
+	for (iterator_link = 0; iterator_link < evaluation->datacenter->l_size; iterator_link++)
+	{
+		link_utilization = evaluation->network_utilization[iterator_link] / 1.0f / (evaluation->datacenter->K[iterator_link] / 1.0f);
+		if (link_utilization > evaluation->MLU)
+		{
+			evaluation->MLU = link_utilization;
+		}
+	}
+	evaluation->MLU_outdated = 0;
+}
+
+/* evaluation_attach: attaches an individual of a population arena to the evaluation state
+ * parameter: evaluation state
+ * parameter: population arena, with the utilization and network utilization of the individual already loaded
+ * parameter: identificator of the individual
+ * returns: nothing, it's void
+ */
+void evaluation_attach(struct evaluation *evaluation, struct population *population, int individual)
+{
+	struct datacenter *datacenter = evaluation->datacenter;
+	/* iterators */
+	int iterator_physical;
+	int iterator_virtual;
+	int iterator_pair;
+	int iterator_link;
+	int physical_position;
+	int physical_position_again;
+
+	evaluation->genes = GENES(population, individual);
+	evaluation->utilization = UTILIZATION(population, individual);
+	evaluation->network_utilization = NETWORK_UTILIZATION(population, individual);
+	evaluation->power_consumption = 0.0;
+	evaluation->network_traffic = 0;
+	evaluation->revenue = 0.0;
+	evaluation->qos = 0.0;
+	/* (OF1) energy consumption of the turned on physical machines */
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		evaluation->power_consumption += physical_power_consumption(datacenter, iterator_physical,
+			evaluation->utilization[iterator_physical * NUMBER_OF_RESOURCES]);
+	}
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		physical_position = evaluation->genes[iterator_virtual];
+		if (physical_position == 0)
+		{
+			continue;
+		}
+		/* (OF2) network traffic between virtual machines placed in different physical machines, each pair once */
+		for (iterator_pair = datacenter->T->row_start[iterator_virtual]; iterator_pair < datacenter->T->row_start[iterator_virtual + 1]; iterator_pair++)
+		{
+			physical_position_again = evaluation->genes[datacenter->T->column[iterator_pair]];
+			if (physical_position_again != 0 && physical_position_again != physical_position)
+			{
+				evaluation->network_traffic += datacenter->T->value[iterator_pair];
+			}
+		}
+		/* (OF3) revenue and (OF4) QoS of the placed virtual machines */
+		evaluation->revenue += (float) datacenter->V[iterator_virtual][4];
+		evaluation->qos += datacenter->qos[iterator_virtual];
+	}
+	/* (OF5) maximum link utilization */
+	load_MLU(evaluation);
+	/* residual capacity of the network links */
+	evaluation->link_excess = 0;
+	for (iterator_link = 0; iterator_link < datacenter->l_size; iterator_link++)
+	{
+		if (evaluation->network_utilization[iterator_link] > datacenter->K[iterator_link])
+		{
+			evaluation->link_excess += evaluation->network_utilization[iterator_link] - datacenter->K[iterator_link];
+		}
+	}
+}
+
+/* update_link: adds traffic to one network link and keeps track of the MLU and of the traffic over the link capacities
+ * parameter: evaluation state
+ * parameter: network link
+ * parameter: traffic to add, negative to remove
+ * returns: nothing, it's void
+ */
+static void update_link(struct evaluation *evaluation, int link, long long traffic)
+{
+	int link_capacity = evaluation->datacenter->K[link];
+	float capacity = link_capacity / 1.0f;
+	float link_utilization = evaluation->network_utilization[link] / 1.0f / capacity;
+	/* the most used link is relieved, so the MLU has to be searched again */
+	if (traffic < 0 && link_utilization >= evaluation->MLU)
+	{
+		evaluation->MLU_outdated = 1;
+	}
+	/* the traffic over the capacity of the link, before and after the change */
+	if (evaluation->network_utilization[link] > link_capacity)
+	{
+		evaluation->link_excess -= evaluation->network_utilization[link] - link_capacity;
+	}
+	evaluation->network_utilization[link] += traffic;
+	if (evaluation->network_utilization[link] > link_capacity)
+	{
+		evaluation->link_excess += evaluation->network_utilization[link] - link_capacity;
+	}
+	link_utilization = evaluation->network_utilization[link] / 1.0f / capacity;
+	if (link_utilization > evaluation->MLU)
+	{
+		evaluation->MLU = link_utilization;
+	}
+}
+
+/* update_links: adds traffic between two physical machines to the network links they use
+ * parameter: evaluation state
+ * parameter: first physical machine (0-based)
+ * parameter: second physical machine (0-based)
+ * parameter: traffic to add, negative to remove
+ * returns: nothing, it's void
+ */
+static void update_links(struct evaluation *evaluation, int physical, int physical_again, long long traffic)
+{
+	struct network_topology *topology = evaluation->datacenter->topology;
+	/* positions in the sorted link lists of both physical machines */
+	int position = topology->link_start[physical];
+	int position_again = topology->link_start[physical_again];
+	int end = topology->link_start[physical + 1];
+	int end_again = topology->link_start[physical_again + 1];
+	/* merge both lists so a link used by the two physical machines is updated once */
+	while (position < end || position_again < end_again)
+	{
+		if (position_again == end_again || (position < end && topology->link[position] < topology->link[position_again]))
+		{
+			update_link(evaluation, topology->link[position++], traffic);
+		}
+		else if (position == end || topology->link[position_again] < topology->link[position])
+		{
+			update_link(evaluation, topology->link[position_again++], traffic);
+		}
+		else
+		{
+			update_link(evaluation, topology->link[position++], traffic);
+			position_again++;
+		}
+	}
+}
+
+/* add_peer_traffic: accounts the traffic with one peer of a moved virtual machine
+ * parameter: evaluation state
+ * parameter: old physical position of the moved virtual machine
+ * parameter: new physical position of the moved virtual machine
+ * parameter: physical position of the peer
+ * parameter: traffic exchanged with the peer
+ * parameter: number of physical machines touched by the move, updated in place
+ * returns: nothing, it's void
+ */
+static void add_peer_traffic(struct evaluation *evaluation, int old_physical_position, int physical_position,
+	int physical_position_again, long long traffic, int *number_of_touched)
+{
+	int physical;
+	/* not placed peers and peers in the source and destination physical machines do not use the network */
+	if (physical_position_again == 0 || traffic == 0 ||
+		((old_physical_position == 0 || old_physical_position == physical_position_again) &&
+		(physical_position == 0 || physical_position == physical_position_again)))
+	{
+		return;
+	}
+	physical = physical_position_again - 1;
+	if (evaluation->traffic_removed[physical] == 0 && evaluation->traffic_added[physical] == 0)
+	{
+		evaluation->touched_physical[(*number_of_touched)++] = physical;
+	}
+	if (old_physical_position != 0 && old_physical_position != physical_position_again)
+	{
+		evaluation->network_traffic -= traffic;
+		evaluation->traffic_removed[physical] += traffic;
+	}
+	if (physical_position != 0 && physical_position != physical_position_again)
+	{
+		evaluation->network_traffic += traffic;
+		evaluation->traffic_added[physical] += traffic;
+	}
+}
+
+/* evaluation_move_vm: moves a virtual machine of the attached individual and updates every objective in place
+ * parameter: evaluation state
+ * parameter: identificator of the virtual machine
+ * parameter: new physical position, from 1 to h_size, or 0 to leave the virtual machine not placed
+ * returns: nothing, it's void
+ */
+void evaluation_move_vm(struct evaluation *evaluation, int virtual, int physical_position)
+{
+	struct datacenter *datacenter = evaluation->datacenter;
+	int *requirements = datacenter->V[virtual];
+	int *utilization;
+	int old_physical_position = evaluation->genes[virtual];
+	/* iterators */
+	int iterator_pair;
+	int iterator_touched;
+	int number_of_touched = 0;
+	int physical;
+
+	if (old_physical_position == physical_position)
+	{
+		return;
+	}
+	/* (OF1) and utilization: release the resources of the source physical machine */
+	if (old_physical_position != 0)
+	{
+		utilization = evaluation->utilization + (old_physical_position - 1) * NUMBER_OF_RESOURCES;
+		evaluation->power_consumption -= physical_power_consumption(datacenter, old_physical_position - 1, utilization[0]);
+		utilization[0] -= requirements[0];
+		utilization[1] -= requirements[1];
+		utilization[2] -= requirements[2];
+		evaluation->power_consumption += physical_power_consumption(datacenter, old_physical_position - 1, utilization[0]);
+	}
+	/* (OF1) and utilization: take the resources of the destination physical machine */
+	if (physical_position != 0)
+	{
+		utilization = evaluation->utilization + (physical_position - 1) * NUMBER_OF_RESOURCES;
+		evaluation->power_consumption -= physical_power_consumption(datacenter, physical_position - 1, utilization[0]);
+		utilization[0] += requirements[0];
+		utilization[1] += requirements[1];
+		utilization[2] += requirements[2];
+		evaluation->power_consumption += physical_power_consumption(datacenter, physical_position - 1, utilization[0]);
+	}
+	/* (OF3) and (OF4): revenue and QoS change only when the virtual machine is placed or removed */
+	if (old_physical_position == 0 || physical_position == 0)
+	{
+		if (physical_position != 0)
+		{
+			evaluation->revenue += (float) requirements[4];
+			evaluation->qos += datacenter->qos[virtual];
+		}
+		else
+		{
+			evaluation->revenue -= (float) requirements[4];
+			evaluation->qos -= datacenter->qos[virtual];
+		}
+	}
+	/* (OF2): traffic exchanged with every placed peer, aggregated by the peer physical machine */
+	for (iterator_pair = datacenter->T->row_start[virtual]; iterator_pair < datacenter->T->row_start[virtual + 1]; iterator_pair++)
+	{
+		add_peer_traffic(evaluation, old_physical_position, physical_position,
+			evaluation->genes[datacenter->T->column[iterator_pair]], datacenter->T->value[iterator_pair], &number_of_touched);
+	}
+	for (iterator_pair = datacenter->T->column_start[virtual]; iterator_pair < datacenter->T->column_start[virtual + 1]; iterator_pair++)
+	{
+		add_peer_traffic(evaluation, old_physical_position, physical_position,
+			evaluation->genes[datacenter->T->row[iterator_pair]], datacenter->T->column_value[iterator_pair], &number_of_touched);
+	}
+	/* (OF5): move the aggregated traffic between the links of each pair of physical machines */
+	for (iterator_touched = 0; iterator_touched < number_of_touched; iterator_touched++)
+	{
+		physical = evaluation->touched_physical[iterator_touched];
+		if (evaluation->traffic_removed[physical] != 0)
+		{
+			update_links(evaluation, old_physical_position - 1, physical, -evaluation->traffic_removed[physical]);
+		}
+		if (evaluation->traffic_added[physical] != 0)
+		{
+			update_links(evaluation, physical_position - 1, physical, evaluation->traffic_added[physical]);
+		}
+		evaluation->traffic_removed[physical] = 0;
+		evaluation->traffic_added[physical] = 0;
+	}
+	evaluation->genes[virtual] = physical_position;
+}
+
+/* evaluation_objectives: gets the cost of each objective function of the attached individual
+ * parameter: evaluation state
+ * parameter: array of 5 costs to fill
+ * returns: nothing, it's void
+ */
+void evaluation_objectives(struct evaluation *evaluation, float *objectives)
+{
+	if (evaluation->MLU_outdated)
+	{
+		load_MLU(evaluation);
+	}
+	objectives[0] = (float) evaluation->power_consumption;
+	objectives[1] = (float) evaluation->network_traffic;
+	objectives[2] = (float) evaluation->revenue;
+	objectives[3] = (float) evaluation->qos;
+	objectives[4] = evaluation->MLU;
+}
@@ -0,0 +1,54 @@
+/*
+ * evaluation.h: Virtual Machine Placement Problem - Incremental Evaluation Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef EVALUATION_H
+#define EVALUATION_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "population.h"
+#include "datacenter.h"
+#include "scratch.h"
+
+/* structure of the evaluation state of one individual, its rows live in a population arena */
+struct evaluation
+{
+	struct datacenter *datacenter;
+	/* rows of the attached individual */
+	int *genes;
+	int *utilization;
+	long long *network_utilization;
+	/* running values of the objective functions */
+	double power_consumption;
+	long long network_traffic;
+	double revenue;
+	double qos;
+	/* maximum link utilization, recalculated on demand when the most used link is relieved */
+	float MLU;
+	int MLU_outdated;
+	/* traffic over the capacity of the overloaded network links, 0 if no link is overloaded */
+	long long link_excess;
+	/* scratch space: traffic removed from and added to each physical machine by a move */
+	long long *traffic_removed;
+	long long *traffic_added;
+	int *touched_physical;
+};
+
+/* function headers definitions */
+struct evaluation * evaluation_create(struct datacenter *datacenter);
+struct evaluation * evaluation_create_scratch(struct datacenter *datacenter, struct scratch *scratch);
+void evaluation_free(struct evaluation *evaluation);
+void evaluation_attach(struct evaluation *evaluation, struct population *population, int individual);
+void evaluation_move_vm(struct evaluation *evaluation, int virtual, int physical_position);
+void evaluation_objectives(struct evaluation *evaluation, float *objectives);
+double physical_power_consumption(struct datacenter *datacenter, int physical, int cpu_utilization);
+
+#endif
@@ -0,0 +1,281 @@
+/*
+ * feasibility.c: Virtual Machine Placement Problem - Instance Feasibility Check
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include instance feasibility check header */
+#include "feasibility.h"
+
+/* virtual machine in the first fit decreasing order */
+struct packing_item
+{
+	float size;
+	int virtual;
+};
+
+/* compare_decreasing: orders integers from the biggest, for qsort
+ * parameter: first integer
+ * parameter: second integer
+ * returns: negative if the first one goes before, positive if after, 0 if equal
+ */
+static int compare_decreasing(const void *first, const void *second)
+{
+	return (*(const int *) second > *(const int *) first) - (*(const int *) second < *(const int *) first);
+}
+
+/* compare_items: orders the virtual machines from the biggest, the smallest identificator first among equals, for qsort
+ * parameter: first item
+ * parameter: second item
+ * returns: negative if the first one goes before, positive if after, 0 if equal
+ */
+static int compare_items(const void *first, const void *second)
+{
+	const struct packing_item *item = (const struct packing_item *) first;
+	const struct packing_item *item_again = (const struct packing_item *) second;
+	if (item->size != item_again->size)
+	{
+		return item->size > item_again->size ? -1 : 1;
+	}
+	return item->virtual - item_again->virtual;
+}
+
+/* count_bigger: counts the sizes bigger than a value
+ * parameter: sizes sorted from the biggest
+ * parameter: number of sizes
+ * parameter: value
+ * returns: the number of sizes bigger than the value, they are the first ones
+ */
+static int count_bigger(const int *sizes, int number_of_sizes, long long value)
+{
+	int low = 0;
+	int high = number_of_sizes;
+	int middle;
+	while (low < high)
+	{
+		middle = (low + high) / 2;
+		if (sizes[middle] > value)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	return low;
+}
+
+/* lower_bound_L2: Martello and Toth lower bound of the bins of a capacity needed to hold some sizes. For each alpha
+ * among 0 and the sizes up to half the capacity, the sizes over the capacity - alpha and over half the capacity need a
+ * bin each, and the sizes from alpha to half the capacity fill the room left in the bins of the second ones first.
+ * It is at least the L1 bound, the total size over the capacity, and it takes O(n log n)
+ * parameter: sizes sorted from the biggest, none of them bigger than the capacity
+ * parameter: prefix sums of the sizes, prefix[i] is the sum of the first i sizes
+ * parameter: number of sizes
+ * parameter: capacity of a bin
+ * returns: the lower bound
+ */
+static long long lower_bound_L2(const int *sizes, const long long *prefix, int number_of_sizes, long long capacity)
+{
+	/* iterator */
+	int iterator_size;
+	long long alpha;
+	long long bound;
+	long long best = (prefix[number_of_sizes] + capacity - 1) / capacity;
+	long long room;
+	int big;
+	int medium;
+	int small;
+	for (iterator_size = number_of_sizes; iterator_size >= 0; iterator_size--)
+	{
+		/* alpha takes 0 and every distinct size up to half the capacity, from the smallest */
+		alpha = iterator_size == number_of_sizes ? 0 : sizes[iterator_size];
+		if (2 * alpha > capacity)
+		{
+			break;
+		}
+		if (iterator_size < number_of_sizes && iterator_size > 0 && sizes[iterator_size - 1] == alpha)
+		{
+			continue;
+		}
+		/* big: size > capacity - alpha, medium: capacity / 2 < size <= capacity - alpha, small: alpha <= size <= capacity / 2 */
+		big = count_bigger(sizes, number_of_sizes, capacity - alpha);
+		medium = count_bigger(sizes, number_of_sizes, capacity / 2) - big;
+		small = count_bigger(sizes, number_of_sizes, alpha - 1) - big - medium;
+		room = (long long) medium * capacity - (prefix[big + medium] - prefix[big]);
+		bound = big + medium;
+		if (prefix[big + medium + small] - prefix[big + medium] > room)
+		{
+			bound += (prefix[big + medium + small] - prefix[big + medium] - room + capacity - 1) / capacity;
+		}
+		if (bound > best)
+		{
+			best = bound;
+		}
+	}
+	return best;
+}
+
+/* feasibility_check: checks if the virtual machines placed mandatorily fit in the physical machines, in O(V log V).
+ * Infeasibility is proven by a virtual machine that fits in no physical machine, a resource whose demand exceeds the
+ * capacity of the datacenter, or a resource whose L1 or L2 bound exceeds the number of physical machines; feasibility is proven by a first fit decreasing placement. The network links are not checked
+ * parameter: datacenter instance
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: report to fill
+ * returns: the reason of the answer, FEASIBILITY_FEASIBLE to FEASIBILITY_LOWER_BOUND
+ */
+int feasibility_check(struct datacenter *datacenter, int max_SLA, struct feasibility_report *report)
+{
+	struct timespec start;
+	struct timespec end;
+	struct capacity_index *index = capacity_index_create(datacenter);
+	int *utilization = (int *) calloc (datacenter->h_size * NUMBER_OF_RESOURCES + 1, sizeof (int));
+	struct packing_item *items = (struct packing_item *) malloc ((datacenter->v_size + 1) * sizeof (struct packing_item));
+	int *sizes = (int *) malloc ((datacenter->v_size + 1) * sizeof (int));
+	long long *prefix = (long long *) malloc ((datacenter->v_size + 1) * sizeof (long long));
+	int *capacities = (int *) malloc ((datacenter->h_size + 1) * sizeof (int));
+	/* iterators */
+	int iterator_virtual;
+	int iterator_physical;
+	int iterator_resource;
+	int number_of_sizes;
+	int physical;
+	int biggest;
+	long long bound;
+	long long covered;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	memset(report, 0, sizeof (struct feasibility_report));
+	report->reason = FEASIBILITY_FEASIBLE;
+	report->resource = -1;
+	report->virtual = -1;
+	capacity_index_attach(index, utilization);
+	/* the mandatory virtual machines, each one has to fit in some physical machine */
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		if (datacenter->V[iterator_virtual][3] != max_SLA)
+		{
+			continue;
+		}
+		if (report->reason == FEASIBILITY_FEASIBLE && capacity_index_find(index, datacenter->V[iterator_virtual], FIT_FIRST, 0) < 0)
+		{
+			report->reason = FEASIBILITY_OVERSIZED;
+			report->virtual = iterator_virtual;
+		}
+		for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+		{
+			report->demand[iterator_resource] += datacenter->V[iterator_virtual][iterator_resource];
+		}
+		items[report->number_of_mandatory].size = capacity_index_size(index, datacenter->V[iterator_virtual]);
+		items[report->number_of_mandatory++].virtual = iterator_virtual;
+	}
+	/* aggregate capacity and lower bounds of each resource */
+	for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+	{
+		for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+		{
+			capacities[iterator_physical] = datacenter->H[iterator_physical][iterator_resource];
+			report->capacity[iterator_resource] += capacities[iterator_physical];
+		}
+		if (report->reason == FEASIBILITY_FEASIBLE && report->demand[iterator_resource] > report->capacity[iterator_resource])
+		{
+			report->reason = FEASIBILITY_CAPACITY;
+			report->resource = iterator_resource;
+		}
+		/* L1: the fewest physical machines, the biggest ones, whose capacities add up to the demand */
+		qsort(capacities, datacenter->h_size, sizeof (int), compare_decreasing);
+		biggest = datacenter->h_size > 0 ? capacities[0] : 0;
+		covered = 0;
+		for (iterator_physical = 0; iterator_physical < datacenter->h_size && covered < report->demand[iterator_resource]; iterator_physical++)
+		{
+			covered += capacities[iterator_physical];
+		}
+		report->lower_bound[iterator_resource] = covered < report->demand[iterator_resource] ? datacenter->h_size + 1 : iterator_physical;
+		number_of_sizes = 0;
+		for (iterator_virtual = 0; iterator_virtual < report->number_of_mandatory; iterator_virtual++)
+		{
+			if (datacenter->V[items[iterator_virtual].virtual][iterator_resource] > 0)
+			{
+				sizes[number_of_sizes++] = datacenter->V[items[iterator_virtual].virtual][iterator_resource];
+			}
+		}
+		/* the bound needs every size within the capacity, an oversized virtual machine was already reported */
+		if (number_of_sizes == 0 || biggest == 0 || report->reason == FEASIBILITY_OVERSIZED)
+		{
+			continue;
+		}
+		qsort(sizes, number_of_sizes, sizeof (int), compare_decreasing);
+		prefix[0] = 0;
+		for (iterator_virtual = 0; iterator_virtual < number_of_sizes; iterator_virtual++)
+		{
+			prefix[iterator_virtual + 1] = prefix[iterator_virtual] + sizes[iterator_virtual];
+		}
+		/* L2 with every physical machine as big as the biggest one, a relaxation of the placement */
+		bound = lower_bound_L2(sizes, prefix, number_of_sizes, biggest);
+		if (bound > report->lower_bound[iterator_resource])
+		{
+			report->lower_bound[iterator_resource] = bound > datacenter->h_size ? datacenter->h_size + 1 : (int) bound;
+		}
+		if (report->reason == FEASIBILITY_FEASIBLE && bound > datacenter->h_size)
+		{
+			report->reason = FEASIBILITY_LOWER_BOUND;
+			report->resource = iterator_resource;
+		}
+	}
+	/* first fit decreasing placement of the mandatory virtual machines */
+	if (report->reason == FEASIBILITY_FEASIBLE)
+	{
+		qsort(items, report->number_of_mandatory, sizeof (struct packing_item), compare_items);
+		for (iterator_virtual = 0; iterator_virtual < report->number_of_mandatory; iterator_virtual++)
+		{
+			physical = capacity_index_find(index, datacenter->V[items[iterator_virtual].virtual], FIT_FIRST, 0);
+			if (physical < 0)
+			{
+				report->reason = FEASIBILITY_UNKNOWN;
+				report->virtual = items[iterator_virtual].virtual;
+				break;
+			}
+			if (utilization[physical * NUMBER_OF_RESOURCES] == 0 && utilization[physical * NUMBER_OF_RESOURCES + 1] == 0 &&
+				utilization[physical * NUMBER_OF_RESOURCES + 2] == 0)
+			{
+				report->physical_used++;
+			}
+			for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+			{
+				utilization[physical * NUMBER_OF_RESOURCES + iterator_resource] += datacenter->V[items[iterator_virtual].virtual][iterator_resource];
+			}
+			capacity_index_update(index, physical);
+			report->placed++;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	report->milliseconds = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+	capacity_index_free(index);
+	free(utilization);
+	free(items);
+	free(sizes);
+	free(prefix);
+	free(capacities);
+	return report->reason;
+}
+
+/* feasibility_reason: name of the reason of an answer of the check
+ * parameter: reason, FEASIBILITY_FEASIBLE to FEASIBILITY_LOWER_BOUND
+ * returns: the name
+ */
+const char * feasibility_reason(int reason)
+{
+	switch (reason)
+	{
+		case FEASIBILITY_FEASIBLE:
+			return "feasible";
+		case FEASIBILITY_UNKNOWN:
+			return "unknown";
+		case FEASIBILITY_OVERSIZED:
+			return "oversized";
+		case FEASIBILITY_CAPACITY:
+			return "capacity";
+		default:
+			return "lower-bound";
+	}
+}
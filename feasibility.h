@@ -0,0 +1,50 @@
+/*
+ * feasibility.h: Virtual Machine Placement Problem - Instance Feasibility Check Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef FEASIBILITY_H
+#define FEASIBILITY_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "population.h"
+#include "datacenter.h"
+#include "capacity.h"
+/* definitions, the answers of the check: proven feasible, not proven, and the proofs of infeasibility */
+#define FEASIBILITY_FEASIBLE 0
+#define FEASIBILITY_UNKNOWN 1
+#define FEASIBILITY_OVERSIZED 2
+#define FEASIBILITY_CAPACITY 3
+#define FEASIBILITY_LOWER_BOUND 4
+
+/* structure of the answer of the check over the virtual machines placed mandatorily */
+struct feasibility_report
+{
+	int reason;
+	/* resource or virtual machine proving the infeasibility, -1 if none */
+	int resource;
+	int virtual;
+	int number_of_mandatory;
+	/* by resource: demand of the mandatory virtual machines, capacity of the datacenter,
+	 * and lower bound of the physical machines needed to hold the demand */
+	long long demand[NUMBER_OF_RESOURCES];
+	long long capacity[NUMBER_OF_RESOURCES];
+	int lower_bound[NUMBER_OF_RESOURCES];
+	/* mandatory virtual machines and physical machines used by the first fit decreasing placement */
+	int placed;
+	int physical_used;
+	double milliseconds;
+};
+
+/* function headers definitions */
+int feasibility_check(struct datacenter *datacenter, int max_SLA, struct feasibility_report *report);
+const char * feasibility_reason(int reason);
+
+#endif
@@ -0,0 +1,311 @@
+/*
+ * generator.c: Virtual Machine Placement Problem - Synthetic Datacenter Instance Generator
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include synthetic datacenter instance generator header */
+#include "generator.h"
+
+/* physical machine types of the bundled instances: Processor, Memory, Storage and Power Consumption */
+static const int physical_types[][4] =
+{
+	{180, 512, 10000, 1000},
+	{350, 1024, 10000, 1300}
+};
+
+/* virtual machine types of the bundled instances: Processor, Memory, Storage and Economical Revenue */
+static const int virtual_types[][4] =
+{
+	{1, 1, 1, 9}, {1, 2, 1, 18}, {1, 4, 4, 50}, {2, 4, 1, 37}, {2, 4, 32, 75}, {2, 8, 32, 100}, {2, 15, 32, 126},
+	{4, 8, 80, 151}, {4, 15, 80, 201}, {4, 30, 80, 252}, {8, 15, 160, 302}, {8, 30, 160, 403}, {8, 61, 160, 504},
+	{16, 30, 320, 604}, {16, 122, 1, 320}, {32, 60, 640, 1209}, {32, 244, 1, 320}
+};
+
+/* generator_defaults: sets the default options of a synthetic instance
+ * parameter: options to fill
+ * parameter: number of physical machines
+ * parameter: number of virtual machines
+ * returns: nothing, it's void
+ */
+void generator_defaults(struct generator_options *options, int h_size, int v_size)
+{
+	options->h_size = h_size;
+	options->v_size = v_size;
+	options->peers = GENERATOR_PEERS;
+	options->max_traffic = GENERATOR_MAX_TRAFFIC;
+	options->group_size = 0;
+	options->topology = TOPOLOGY_FLAT;
+	options->rack_size = GENERATOR_RACK_SIZE;
+	options->pod_size = GENERATOR_POD_SIZE;
+	options->link_capacity = GENERATOR_LINK_CAPACITY;
+	options->mandatory = GENERATOR_MANDATORY;
+	options->seed = 1;
+}
+
+/* generate_traffic: draws the pairs of virtual machines with traffic, each virtual machine draws half of its peers
+ * inside its group, so the traffic of a pair never exceeds twice the most traffic of a pair
+ * parameter: options of the instance
+ * parameter: random stream
+ * returns: T matrix
+ */
+static struct traffic_matrix * generate_traffic(const struct generator_options *options, struct random *random)
+{
+	int v_size = options->v_size;
+	int group_size = options->group_size > 0 && options->group_size < v_size ? options->group_size : v_size;
+	double draws = options->peers / 2.0;
+	long long entries_size = (long long) ceil (draws + 1.0) * v_size + 1;
+	int *rows = (int *) malloc (entries_size * sizeof (int));
+	int *columns = (int *) malloc (entries_size * sizeof (int));
+	int *values = (int *) malloc (entries_size * sizeof (int));
+	/* last virtual machine that drew each peer, so a virtual machine draws a peer once */
+	int *drawn = (int *) malloc ((v_size + 1) * sizeof (int));
+	/* iterators */
+	int iterator_virtual;
+	int iterator_draw;
+	int number_of_draws;
+	int number_of_entries = 0;
+	int group_begin;
+	int group_end;
+	int peer;
+	struct traffic_matrix *T;
+	memset(drawn, -1, (v_size + 1) * sizeof (int));
+	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	{
+		group_begin = iterator_virtual / group_size * group_size;
+		group_end = group_begin + group_size < v_size ? group_begin + group_size : v_size;
+		if (group_end - group_begin < 2)
+		{
+			continue;
+		}
+		/* the fraction of the draws is drawn too, so the average number of peers is kept */
+		number_of_draws = (int) draws + (random_double(random) < draws - (int) draws);
+		for (iterator_draw = 0; iterator_draw < number_of_draws && iterator_draw < group_end - group_begin - 1; iterator_draw++)
+		{
+			peer = group_begin + random_int(random, group_end - group_begin - 1);
+			peer += peer >= iterator_virtual;
+			if (drawn[peer] == iterator_virtual)
+			{
+				continue;
+			}
+			drawn[peer] = iterator_virtual;
+			rows[number_of_entries] = iterator_virtual;
+			columns[number_of_entries] = peer;
+			values[number_of_entries] = 1 + random_int(random, options->max_traffic);
+			number_of_entries++;
+		}
+	}
+	T = traffic_matrix_build(v_size, number_of_entries, rows, columns, values);
+	free(rows);
+	free(columns);
+	free(values);
+	free(drawn);
+	return T;
+}
+
+/* generate_topology: builds the links of the shape of the topology and their capacities
+ * parameter: options of the instance
+ * parameter: datacenter instance, to fill its topology, number of links and capacities
+ * returns: nothing, it's void
+ */
+static void generate_topology(const struct generator_options *options, struct datacenter *datacenter)
+{
+	int h_size = options->h_size;
+	int rack_size = options->rack_size > 0 ? options->rack_size : 1;
+	int pod_size = options->pod_size > 0 ? options->pod_size : 1;
+	int number_of_racks = options->topology >= TOPOLOGY_RACK ? (h_size + rack_size - 1) / rack_size : 0;
+	int number_of_pods = options->topology >= TOPOLOGY_POD ? (number_of_racks + pod_size - 1) / pod_size : 0;
+	int number_of_entries = h_size * (1 + (number_of_racks > 0) + (number_of_pods > 0));
+	/* entries of G sorted by link: the uplinks, then the rack links, then the pod links */
+	int *links = (int *) malloc ((number_of_entries + 1) * sizeof (int));
+	int *physicals = (int *) malloc ((number_of_entries + 1) * sizeof (int));
+	/* iterators */
+	int iterator_physical;
+	int iterator_entry = 0;
+	datacenter->l_size = h_size + number_of_racks + number_of_pods;
+	datacenter->K = (int *) malloc ((datacenter->l_size + 1) * sizeof (int));
+	for (iterator_physical = 0; iterator_physical < h_size; iterator_physical++)
+	{
+		links[iterator_entry] = iterator_physical;
+		physicals[iterator_entry++] = iterator_physical;
+		datacenter->K[iterator_physical] = options->link_capacity;
+	}
+	for (iterator_physical = 0; number_of_racks > 0 && iterator_physical < h_size; iterator_physical++)
+	{
+		links[iterator_entry] = h_size + iterator_physical / rack_size;
+		physicals[iterator_entry++] = iterator_physical;
+		datacenter->K[h_size + iterator_physical / rack_size] = (int) ((long long) options->link_capacity * rack_size / 2);
+	}
+	for (iterator_physical = 0; number_of_pods > 0 && iterator_physical < h_size; iterator_physical++)
+	{
+		links[iterator_entry] = h_size + number_of_racks + iterator_physical / rack_size / pod_size;
+		physicals[iterator_entry++] = iterator_physical;
+		datacenter->K[h_size + number_of_racks + iterator_physical / rack_size / pod_size] =
+			(int) ((long long) options->link_capacity * rack_size * pod_size / 4);
+	}
+	datacenter->topology = network_topology_build(h_size, datacenter->l_size, number_of_entries, links, physicals);
+	free(links);
+	free(physicals);
+}
+
+/* generator_create: generates a synthetic datacenter instance, the same options and seed give the same instance.
+ * The physical and virtual machines are drawn from the types of the bundled instances
+ * parameter: options of the instance
+ * parameter: datacenter instance to fill, released with datacenter_free
+ * returns: nothing, it's void
+ */
+void generator_create(const struct generator_options *options, struct datacenter *datacenter)
+{
+	int number_of_physical_types = sizeof (physical_types) / sizeof (physical_types[0]);
+	int number_of_virtual_types = sizeof (virtual_types) / sizeof (virtual_types[0]);
+	int *H_table = (int *) malloc ((options->h_size + 1) * 4 * sizeof (int));
+	int *V_table = (int *) malloc ((options->v_size + 1) * 5 * sizeof (int));
+	/* iterators */
+	int iterator_physical;
+	int iterator_virtual;
+	int type;
+	struct random random;
+	memset(datacenter, 0, sizeof (struct datacenter));
+	random_seed(&random, options->seed, 0);
+	datacenter->h_size = options->h_size;
+	datacenter->v_size = options->v_size;
+	datacenter->H = (int **) malloc ((options->h_size + 1) * sizeof (int *));
+	datacenter->V = (int **) malloc ((options->v_size + 1) * sizeof (int *));
+	for (iterator_physical = 0; iterator_physical < options->h_size; iterator_physical++)
+	{
+		datacenter->H[iterator_physical] = H_table + iterator_physical * 4;
+		memcpy(datacenter->H[iterator_physical], physical_types[random_int(&random, number_of_physical_types)], 4 * sizeof (int));
+	}
+	for (iterator_virtual = 0; iterator_virtual < options->v_size; iterator_virtual++)
+	{
+		datacenter->V[iterator_virtual] = V_table + iterator_virtual * 5;
+		type = random_int(&random, number_of_virtual_types);
+		memcpy(datacenter->V[iterator_virtual], virtual_types[type], 3 * sizeof (int));
+		datacenter->V[iterator_virtual][3] = random_double(&random) < options->mandatory;
+		datacenter->V[iterator_virtual][4] = virtual_types[type][3];
+	}
+	datacenter->T = generate_traffic(options, &random);
+	generate_topology(options, datacenter);
+	datacenter_derive(datacenter);
+}
+
+/* write_integer: appends an integer and a separator to a line
+ * parameter: end of the line so far
+ * parameter: integer, not negative
+ * parameter: separator
+ * returns: the new end of the line
+ */
+static char * write_integer(char *line, int integer, char separator)
+{
+	char digits[16];
+	int number_of_digits = 0;
+	do
+	{
+		digits[number_of_digits++] = (char) ('0' + integer % 10);
+		integer /= 10;
+	}
+	while (integer > 0);
+	while (number_of_digits > 0)
+	{
+		*line++ = digits[--number_of_digits];
+	}
+	*line++ = separator;
+	return line;
+}
+
+/* generator_write: writes a datacenter instance as a datacenter infrastructure file. T is written as its upper
+ * triangle, the loader adds T[i][j] and T[j][i], so the file loads back into the same instance
+ * parameter: path to the datacenter infrastructure file
+ * parameter: datacenter instance
+ * returns: 0 if it was written, -1 otherwise
+ */
+int generator_write(const char *path_to_file, struct datacenter *datacenter)
+{
+	FILE *datacenter_file;
+	struct traffic_matrix *T = datacenter->T;
+	struct network_topology *topology = datacenter->topology;
+	int size = datacenter->v_size > datacenter->h_size ? datacenter->v_size : datacenter->h_size;
+	/* a row of values and its text, the 10 digits of a traffic up to MAX_TRAFFIC and a separator per value at most */
+	int *row = (int *) calloc (size + 1, sizeof (int));
+	char *line = (char *) malloc ((size_t) size * 11 + 2);
+	char *end;
+	/* iterators */
+	int iterator_physical;
+	int iterator_virtual;
+	int iterator_pair;
+	int iterator_link;
+	int iterator_position;
+	int iterator_column;
+	if (datacenter->v_size > GENERATOR_TEXT_LIMIT)
+	{
+		printf("[ERROR] %d virtual machines are too many for the dense traffic matrix of the text format, write a .vmpb file\n",
+			datacenter->v_size);
+		free(row);
+		free(line);
+		return -1;
+	}
+	datacenter_file = fopen(path_to_file, "w");
+	if (datacenter_file == NULL)
+	{
+		printf("[ERROR] can not write the datacenter file %s\n", path_to_file);
+		free(row);
+		free(line);
+		return -1;
+	}
+	fprintf(datacenter_file, "PHYSICAL MACHINES\n\n");
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		fprintf(datacenter_file, "%d\t%d\t%d\t%d\n", datacenter->H[iterator_physical][0], datacenter->H[iterator_physical][1],
+			datacenter->H[iterator_physical][2], datacenter->H[iterator_physical][3]);
+	}
+	fprintf(datacenter_file, "\nVIRTUAL MACHINES\n\n");
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		fprintf(datacenter_file, "%d\t%d\t%d\t%d\t%d\n", datacenter->V[iterator_virtual][0], datacenter->V[iterator_virtual][1],
+			datacenter->V[iterator_virtual][2], datacenter->V[iterator_virtual][3], datacenter->V[iterator_virtual][4]);
+	}
+	fprintf(datacenter_file, "\nNETWORK TRAFFIC\n\n");
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		for (iterator_pair = T->row_start[iterator_virtual]; iterator_pair < T->row_start[iterator_virtual + 1]; iterator_pair++)
+		{
+			row[T->column[iterator_pair]] = T->value[iterator_pair];
+		}
+		end = line;
+		for (iterator_column = 0; iterator_column < datacenter->v_size; iterator_column++)
+		{
+			end = write_integer(end, row[iterator_column], iterator_column + 1 < datacenter->v_size ? '\t' : '\n');
+		}
+		fwrite(line, 1, end - line, datacenter_file);
+		for (iterator_pair = T->row_start[iterator_virtual]; iterator_pair < T->row_start[iterator_virtual + 1]; iterator_pair++)
+		{
+			row[T->column[iterator_pair]] = 0;
+		}
+	}
+	/* G: a row per link, with the physical machines using it */
+	fprintf(datacenter_file, "\nNETWORK TOPOLOGY\n\n");
+	for (iterator_link = 0; iterator_link < datacenter->l_size; iterator_link++)
+	{
+		end = line;
+		for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+		{
+			row[iterator_physical] = 0;
+			for (iterator_position = topology->link_start[iterator_physical]; iterator_position < topology->link_start[iterator_physical + 1];
+				iterator_position++)
+			{
+				row[iterator_physical] |= topology->link[iterator_position] == iterator_link;
+			}
+			end = write_integer(end, row[iterator_physical], iterator_physical + 1 < datacenter->h_size ? '\t' : '\n');
+			row[iterator_physical] = 0;
+		}
+		fwrite(line, 1, end - line, datacenter_file);
+	}
+	fprintf(datacenter_file, "\nNETWORK LINK CAPACITY\n\n");
+	for (iterator_link = 0; iterator_link < datacenter->l_size; iterator_link++)
+	{
+		fprintf(datacenter_file, "%d\n", datacenter->K[iterator_link]);
+	}
+	free(row);
+	free(line);
+	return fclose(datacenter_file) == 0 ? 0 : -1;
+}
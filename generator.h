@@ -0,0 +1,62 @@
+/*
+ * generator.h: Virtual Machine Placement Problem - Synthetic Datacenter Instance Generator Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "datacenter.h"
+#include "network.h"
+#include "loader.h"
+#include "random.h"
+/* definitions, the shapes of the network topology */
+#define TOPOLOGY_FLAT 0
+#define TOPOLOGY_RACK 1
+#define TOPOLOGY_POD 2
+/* definitions, the default values of the options */
+#define GENERATOR_PEERS 16.0
+#define GENERATOR_MAX_TRAFFIC 512
+#define GENERATOR_RACK_SIZE 20
+#define GENERATOR_POD_SIZE 8
+#define GENERATOR_LINK_CAPACITY 1000000
+#define GENERATOR_MANDATORY 0.5
+/* virtual machines over which the text format, with its dense traffic matrix, is refused */
+#define GENERATOR_TEXT_LIMIT 20000
+
+/* structure of the options of a synthetic instance */
+struct generator_options
+{
+	int h_size;
+	int v_size;
+	/* average number of virtual machines each one exchanges traffic with, and the most traffic of a pair */
+	double peers;
+	int max_traffic;
+	/* virtual machines of an application, the peers are drawn inside it, 0 for the whole datacenter */
+	int group_size;
+	/* TOPOLOGY_FLAT: an uplink per physical machine, TOPOLOGY_RACK: also a link per rack of rack_size physical
+	 * machines, TOPOLOGY_POD: also a link per pod of pod_size racks */
+	int topology;
+	int rack_size;
+	int pod_size;
+	/* capacity of an uplink, the rack and pod links are oversubscribed 2:1 and 4:1 */
+	int link_capacity;
+	/* fraction of the virtual machines with the maximum SLA */
+	double mandatory;
+	unsigned long long seed;
+};
+
+/* function headers definitions */
+void generator_defaults(struct generator_options *options, int h_size, int v_size);
+void generator_create(const struct generator_options *options, struct datacenter *datacenter);
+int generator_write(const char *path_to_file, struct datacenter *datacenter);
+
+#endif
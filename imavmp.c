@@ -5,14 +5,6 @@
  * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
  */
 
-/* structure of a pareto element */
-struct pareto_element{
-	int *solution;
-	float *costs;
-	struct pareto_element *prev;
-	struct pareto_element *next;
-};
-
 /* include libraries */
 #include <stdio.h>
 #include <string.h>
@@ -27,22 +19,665 @@ struct pareto_element{
 #include "variation.h"
 #include "network.h"
 #include "pareto.h"
-/* definitions (this could be parameters) */
-#define NUMBER_OF_INDIVIDUALS 100
-#define NUMBER_OF_GENERATIONS 1
-#define SELECTION_PERCENT 0.5
-#define MAX_SLA 1
+#include "population.h"
+#include "datacenter.h"
+#include "loader.h"
+#include "pool.h"
+#include "random.h"
+#include "config.h"
+#include "stopping.h"
+#include "scratch.h"
+#include "nds.h"
+#include "dynamic.h"
+#include "feasibility.h"
+#include "bounds.h"
+
+/* state of the memetic algorithm over a datacenter instance */
+struct memetic
+{
+	struct configuration *configuration;
+	struct datacenter *datacenter;
+	struct pool *pool;
+	struct random *random;
+	struct scratch *scratch;
+	/* ideal and nadir bounds of the objective functions of the instance */
+	struct objective_bounds bounds;
+	/* P_t and Q_t are the halves of a P_t ∪ Q_t arena and the next P_t is selected into the other one,
+	so the generations reuse the same two arenas */
+	struct population *generations[2];
+	int current;
+	struct population P;
+	struct population Q;
+	/* non-dominated fronts of P_t and Q_t according to NSGA-II */
+	int *fronts_P;
+	int *fronts_Q;
+	/* known Pareto set P_c */
+	struct archive *pareto_archive;
+	/* number of generation, for iterative reference of generations, and number of evaluated individuals */
+	int generation;
+	long long evaluations;
+	/* convergence trace of the known Pareto front, NULL if it is not traced, and the time of its next sample */
+	FILE *trace;
+	double next_trace;
+};
+
+/* memetic_create: reserves the populations, the fronts and the archive of the memetic algorithm
+ * parameter: state of the memetic algorithm to fill
+ * parameter: configuration of the run
+ * parameter: datacenter instance
+ * parameter: task pool running the per individual stages in parallel
+ * parameter: random stream of the serial stages
+ * parameter: scratch arena of the temporary arrays of the stages, released at the end of each generation
+ * returns: nothing, it's void
+ */
+static void memetic_create(struct memetic *memetic, struct configuration *configuration, struct datacenter *datacenter,
+	struct pool *pool, struct random *random, struct scratch *scratch)
+{
+	int number_of_individuals = configuration->number_of_individuals;
+	memetic->configuration = configuration;
+	memetic->datacenter = datacenter;
+	memetic->pool = pool;
+	memetic->random = random;
+	memetic->scratch = scratch;
+	objective_bounds_compute(datacenter, configuration->max_SLA, &memetic->bounds);
+	memetic->generations[0] = population_create(2 * number_of_individuals, datacenter->h_size, datacenter->v_size, datacenter->l_size);
+	memetic->generations[1] = population_create(2 * number_of_individuals, datacenter->h_size, datacenter->v_size, datacenter->l_size);
+	memetic->current = 0;
+	population_view(&memetic->P, memetic->generations[memetic->current], 0, number_of_individuals);
+	memetic->fronts_P = (int *) malloc ((number_of_individuals + 1) * sizeof (int));
+	memetic->fronts_Q = (int *) malloc ((number_of_individuals + 1) * sizeof (int));
+	memetic->pareto_archive = archive_create(datacenter->v_size, configuration->archive_capacity, configuration->archive_truncation);
+	memetic->generation = 0;
+	memetic->evaluations = 0;
+	memetic->trace = NULL;
+	memetic->next_trace = 0.0;
+}
+
+/* memetic_free: releases the populations, the fronts and the archive of the memetic algorithm
+ * parameter: state of the memetic algorithm
+ * returns: nothing, it's void
+ */
+static void memetic_free(struct memetic *memetic)
+{
+	free(memetic->fronts_P);
+	free(memetic->fronts_Q);
+	population_free(memetic->generations[0]);
+	population_free(memetic->generations[1]);
+	archive_free(memetic->pareto_archive);
+}
+
+/* memetic_start: prepares P_0 once its placements are set: repairs and evaluates it, and starts P_c with its first front
+ * parameter: state of the memetic algorithm, with the placements of P_0
+ * returns: nothing, it's void
+ */
+static void memetic_start(struct memetic *memetic)
+{
+	struct datacenter *datacenter = memetic->datacenter;
+	struct population *P = &memetic->P;
+	int number_of_individuals = memetic->configuration->number_of_individuals;
+	int iterator_individual;
+	/* Additional task: load the utilization of physical machines and network links of all individuals/solutions */
+	load_utilization(P, datacenter->V, memetic->pool);
+	// printf("\nP_0 UTILIZATION CALCULATED SUCCESSFULLY\n");
+	load_network_utilization(P, datacenter->topology, datacenter->T, memetic->pool, memetic->scratch);
+	// printf("\nP_0 NETWORK UTILIZATION CALCULATED SUCCESSFULLY\n");
+	/* 03: P0’ = repair infeasible solutions of P_0 */
+	reparation(P, datacenter, memetic->configuration->max_SLA, memetic->configuration->repair_policy,
+		random_next(memetic->random), memetic->pool, memetic->scratch);
+	// printf("\nP_0 REPAIRED SUCCESSFULLY\n");
+	/* 04: P0’’ = apply local search to solutions of P_0’ */
+	if (memetic->configuration->local_search_budget > 0)
+	{
+		local_search(P, datacenter, memetic->configuration->local_search_budget, random_next(memetic->random), memetic->pool,
+			memetic->scratch);
+	}
+	/* Additional task: calculate the cost of each objective function for each solution */
+	load_objectives(P, datacenter->H, datacenter->V, datacenter->T, datacenter->K, memetic->pool);
+	memetic->evaluations += number_of_individuals;
+	// printf("\nP_0 OBJECTIVE FUNCTIONS VALUES CALCULATED SUCCESSFULLY\n");
+	/* Additional task: calculate the non-dominated fronts according to NSGA-II */
+	nds_sort_constrained(P->objectives, P->feasible, number_of_individuals, NDS_AUTO, memetic->fronts_P, memetic->scratch);
+	// printf("\nP_0 NON-DOMINATED SORTING CALCULATED SUCCESSFULLY\n");
+	/* 05: Update set of nondominated solutions Pc from P_0’’ */
+	/* considering that the P_c is empty at first population, each non-dominated solution from first front is added,
+	the individuals the reparation could not make factible never enter P_c */
+	for (iterator_individual = 0 ; iterator_individual < number_of_individuals ; iterator_individual++)
+	{
+	 	if(memetic->fronts_P[iterator_individual] == 1 && P->feasible[iterator_individual])
+	 	{
+	 		archive_insert(memetic->pareto_archive, GENES(P, iterator_individual), OBJECTIVES(P, iterator_individual));
+	 	}
+	}
+	// printf("\nP_KNOWN CALCULATED SUCCESSFULLY\n");
+}
+
+/* memetic_construct: builds the configured fraction of P_0 with the constructive heuristics after the seeded
+ * individuals, the rest stays random
+ * parameter: state of the memetic algorithm, with P_0 initialized
+ * parameter: number of seeded individuals, the first ones of P_0, that are kept
+ * returns: nothing, it's void
+ */
+static void memetic_construct(struct memetic *memetic, int number_of_seeds)
+{
+	int number_of_constructed = (int) (memetic->configuration->constructive_ratio * memetic->configuration->number_of_individuals + 0.5f);
+	if (number_of_constructed > 0)
+	{
+		initialization_constructive(&memetic->P, memetic->datacenter, memetic->configuration->max_SLA, number_of_seeds,
+			number_of_constructed, random_next(memetic->random), memetic->pool, memetic->scratch);
+	}
+}
+
+/* memetic_seed: seeds P_0 with the placements of a Pareto set file of a previous run, mapped by the index of the
+ * virtual machines. A set bigger than P_0 is repaired and evaluated as a whole: its first front starts P_c and
+ * its best fronts are carried to P_0, so no member of the previous front is lost
+ * parameter: state of the memetic algorithm, with P_0 initialized
+ * parameter: path to the Pareto set file
+ * returns: number of seeded individuals, the first ones of P_0, -1 if the file can not be read
+ */
+static int memetic_seed(struct memetic *memetic, const char *path_to_file)
+{
+	struct datacenter *datacenter = memetic->datacenter;
+	int number_of_individuals = memetic->configuration->number_of_individuals;
+	int number_of_seeds = pareto_set_size(path_to_file);
+	struct population *seeds;
+	int *fronts_seeds;
+	/* iterators */
+	int iterator_seed = 0;
+	int iterator_individual = 0;
+	int actual_pareto = 0;
+	if (number_of_seeds < 0)
+	{
+		return -1;
+	}
+	if (number_of_seeds <= number_of_individuals)
+	{
+		return pareto_seed_population(path_to_file, &memetic->P, datacenter->V, memetic->configuration->max_SLA);
+	}
+	seeds = population_create(number_of_seeds, datacenter->h_size, datacenter->v_size, datacenter->l_size);
+	initialization(seeds, datacenter->V, memetic->configuration->max_SLA, random_next(memetic->random), memetic->pool);
+	if (pareto_seed_population(path_to_file, seeds, datacenter->V, memetic->configuration->max_SLA) < 0)
+	{
+		population_free(seeds);
+		return -1;
+	}
+	load_utilization(seeds, datacenter->V, memetic->pool);
+	load_network_utilization(seeds, datacenter->topology, datacenter->T, memetic->pool, memetic->scratch);
+	reparation(seeds, datacenter, memetic->configuration->max_SLA, memetic->configuration->repair_policy,
+		random_next(memetic->random), memetic->pool, memetic->scratch);
+	load_objectives(seeds, datacenter->H, datacenter->V, datacenter->T, datacenter->K, memetic->pool);
+	memetic->evaluations += number_of_seeds;
+	fronts_seeds = (int *) malloc ((number_of_seeds + 1) * sizeof (int));
+	nds_sort_constrained(seeds->objectives, seeds->feasible, number_of_seeds, NDS_AUTO, fronts_seeds, memetic->scratch);
+	/* the first front starts P_c, and P_0 takes the best fronts */
+	while (iterator_individual < number_of_individuals)
+	{
+		actual_pareto++;
+		for (iterator_seed = 0; iterator_seed < number_of_seeds && iterator_individual < number_of_individuals; iterator_seed++)
+		{
+			if (fronts_seeds[iterator_seed] == actual_pareto)
+			{
+				if (actual_pareto == 1 && seeds->feasible[iterator_seed])
+				{
+					archive_insert(memetic->pareto_archive, GENES(seeds, iterator_seed), OBJECTIVES(seeds, iterator_seed));
+				}
+				population_copy_individual(&memetic->P, iterator_individual++, seeds, iterator_seed);
+			}
+		}
+	}
+	/* the rest of the first front, that did not fit in P_0 */
+	for (; iterator_seed < number_of_seeds && actual_pareto == 1; iterator_seed++)
+	{
+		if (fronts_seeds[iterator_seed] == 1 && seeds->feasible[iterator_seed])
+		{
+			archive_insert(memetic->pareto_archive, GENES(seeds, iterator_seed), OBJECTIVES(seeds, iterator_seed));
+		}
+	}
+	free(fronts_seeds);
+	population_free(seeds);
+	scratch_reset(memetic->scratch);
+	return number_of_individuals;
+}
+
+/* memetic_trace: writes a sample of the known Pareto front to the convergence trace, once each trace interval of
+ * the run. A sample is a line per member: its time in milliseconds, generation, evaluations and costs
+ * parameter: state of the memetic algorithm
+ * parameter: stopping criteria, started
+ * parameter: 1 to write the sample whatever the time, 0 otherwise
+ * returns: nothing, it's void
+ */
+static void memetic_trace(struct memetic *memetic, struct stopping *stopping, int forced)
+{
+	/* iterator */
+	int iterator_objective;
+	struct pareto_element *element;
+	double elapsed;
+	if (memetic->trace == NULL)
+	{
+		return;
+	}
+	elapsed = stopping_elapsed(stopping);
+	if (!forced && elapsed < memetic->next_trace)
+	{
+		return;
+	}
+	for (element = memetic->pareto_archive->head; element != NULL; element = element->next)
+	{
+		fprintf(memetic->trace, "%.3f\t%d\t%lld", elapsed, memetic->generation, memetic->evaluations);
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			fprintf(memetic->trace, "\t%g", element->costs[iterator_objective]);
+		}
+		fprintf(memetic->trace, "\n");
+	}
+	memetic->next_trace = (floor(elapsed / memetic->configuration->trace_interval) + 1.0) * memetic->configuration->trace_interval;
+}
+
+/* memetic_run: evolves P_t until a stopping criterion is met
+ * parameter: state of the memetic algorithm, started by memetic_start
+ * parameter: stopping criteria, started
+ * returns: the reason to stop
+ */
+static int memetic_run(struct memetic *memetic, struct stopping *stopping)
+{
+	struct configuration *configuration = memetic->configuration;
+	struct datacenter *datacenter = memetic->datacenter;
+	struct population *P = &memetic->P;
+	struct population *Q = &memetic->Q;
+	int number_of_individuals = configuration->number_of_individuals;
+	int iterator_individual;
+	int reason;
+	/* Additional task: identificators for the crossover parents */
+	int father, mother;
+	/* 06: t = 0 */
+	/* 06: Pt = P0’’ */
+	/* 07: While (stopping criterion is not met), do. The archive holds the best front so far at every check */
+	while ((reason = stopping_check(stopping, memetic->generation, memetic->evaluations, memetic->pareto_archive,
+		&memetic->bounds, memetic->scratch)) == STOP_CONTINUE)
+	{
+		memetic_trace(memetic, stopping, 0);
+		// printf("\nGENERATION %d STARTED SUCCESSFULLY\n",generation);
+		/* this is a new generation! */
+		memetic->generation++;
+	 	/* Additional task: Q is a random generated population, lets initialize it */
+		population_view(Q, memetic->generations[memetic->current], number_of_individuals, number_of_individuals);
+		initialization(Q, datacenter->V, configuration->max_SLA, random_next(memetic->random), memetic->pool);
+		/* 08: Q_t = selection of solutions from P_t ∪ P_c */
+		father = selection(memetic->fronts_P, number_of_individuals, configuration->selection_percent, memetic->random);
+		mother = selection(memetic->fronts_P, number_of_individuals, configuration->selection_percent, memetic->random);
+		// printf("\nSELECTION SUCCESSFULL\n");
+		/* 09: Q_t’ = crossover and mutation of solutions of Q_t */
+		crossover(Q, father, mother);
+		// printf("\nCROSSOVER SUCCESSFULL\n");
+		/* 10: Q_t’ = crossover and mutation of solutions of Q_t */
+		// printf("\nMUTATION SUCCESSFULL\n");
+		mutation(Q, datacenter->V, random_next(memetic->random), memetic->pool);
+		/* Additional task: load the utilization of physical machines and network links of all individuals/solutions */
+		load_utilization(Q, datacenter->V, memetic->pool);
+		// printf("\nP_%d UTILIZATION CALCULATED SUCCESSFULLY\n",generation);
+		load_network_utilization(Q, datacenter->topology, datacenter->T, memetic->pool, memetic->scratch);
+		// printf("\nP_%d NETWORK UTILIZATION CALCULATED SUCCESSFULLY\n",generation);
+		/* 10: Q_t’’ = repair infeasible solutions of Q_t’ */
+		reparation(Q, datacenter, configuration->max_SLA, configuration->repair_policy, random_next(memetic->random), memetic->pool,
+			memetic->scratch);
+		// printf("\nP_%d REPAIRED SUCCESSFULLY\n",generation);
+		/* 11: Q_t’’’ = apply local search to solutions of Q_t’’ */
+		if (configuration->local_search_budget > 0)
+		{
+			local_search(Q, datacenter, configuration->local_search_budget, random_next(memetic->random), memetic->pool, memetic->scratch);
+		}
+		/* Additional task: calculate the cost of each objective function for each solution */
+		load_objectives(Q, datacenter->H, datacenter->V, datacenter->T, datacenter->K, memetic->pool);
+		memetic->evaluations += number_of_individuals;
+		// printf("\nP_%d OBJECTIVE FUNCTIONS VALUES CALCULATED SUCCESSFULLY\n",generation);
+		/* Additional task: calculate the non-dominated fronts according to NSGA-II */
+		nds_sort_constrained(Q->objectives, Q->feasible, number_of_individuals, NDS_AUTO, memetic->fronts_Q, memetic->scratch);
+		// printf("\nP_%d NON-DOMINATED SORTING CALCULATED SUCCESSFULLY\n",generation);
+		/* 12: Update set of nondominated solutions Pc from Qt’’’ */
+		for (iterator_individual = 0 ; iterator_individual < number_of_individuals ; iterator_individual++)
+	    	{
+		 	if(memetic->fronts_Q[iterator_individual] == 1 && Q->feasible[iterator_individual])
+		 	{
+		 		archive_insert(memetic->pareto_archive, GENES(Q, iterator_individual), OBJECTIVES(Q, iterator_individual));
+		 	}
+		}
+		// printf("\nP_KNOWN CALCULATED SUCCESSFULLY\n");
+		/* 17: Pt = fitness selection from Pt ∪ Qt’’’ */
+		population_view(P, memetic->generations[1 - memetic->current], 0, number_of_individuals);
+		population_evolution(P, memetic->generations[memetic->current], memetic->fronts_P, memetic->scratch);
+		memetic->current = 1 - memetic->current;
+		// printf("\nP_%d EVOLVED TO P_%d\n",generation-1,generation);
+		scratch_reset(memetic->scratch);
+	}
+	/* the last sample is the known Pareto front the run ends with */
+	memetic_trace(memetic, stopping, 1);
+	return reason;
+}
+
+/* memetic_warm_start: sets the placements of P_0 from the previous time step: the known Pareto set first, then
+ * the population. The virtual machines that were alive keep their physical machine, the arrivals get a random one
+ * parameter: state of the memetic algorithm of the time step
+ * parameter: state of the memetic algorithm of the previous time step, NULL for a random P_0
+ * parameter: virtual machine of the previous time step for each identificator, -1 if it was not alive
+ * parameter: identificator of each virtual machine of the time step
+ * parameter: seed of the random streams of the individuals
+ * returns: nothing, it's void
+ */
+static void memetic_warm_start(struct memetic *memetic, struct memetic *previous, int *previous_virtual, int *virtual_id,
+	unsigned long long seed)
+{
+	struct datacenter *datacenter = memetic->datacenter;
+	int number_of_individuals = memetic->configuration->number_of_individuals;
+	int iterator_individual;
+	int iterator_virtual;
+	int previous_position;
+	/* genes of the current individual and of the one it starts from */
+	int *individual;
+	int *source;
+	struct pareto_element *element = previous != NULL ? previous->pareto_archive->head : NULL;
+	int previous_individual = 0;
+	/* random stream of the current individual */
+	struct random random;
+	if (previous == NULL)
+	{
+		initialization(&memetic->P, datacenter->V, memetic->configuration->max_SLA, seed, memetic->pool);
+		memetic_construct(memetic, 0);
+		return;
+	}
+	for (iterator_individual = 0; iterator_individual < number_of_individuals; iterator_individual++)
+	{
+		individual = GENES(&memetic->P, iterator_individual);
+		random_seed(&random, seed, iterator_individual);
+		if (element != NULL)
+		{
+			source = element->solution;
+			element = element->next;
+		}
+		else
+		{
+			source = GENES(&previous->P, previous_individual++);
+		}
+		for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+		{
+			previous_position = previous_virtual[virtual_id[iterator_virtual]];
+			if (previous_position >= 0)
+			{
+				individual[iterator_virtual] = source[previous_position];
+			}
+			else
+			{
+				individual[iterator_virtual] = generate_solution_position(&random, datacenter->h_size,
+					datacenter->V[iterator_virtual][3] == memetic->configuration->max_SLA);
+			}
+		}
+	}
+}
+
+/* select_decision: selects the placement to apply from the known Pareto set: the compromise solution, with the
+ * smallest sum of its costs normalized by the bounds of the set
+ * parameter: archive of the known Pareto set
+ * returns: element of the selected placement, NULL if the archive is empty
+ */
+static struct pareto_element * select_decision(struct archive *archive)
+{
+	/* iterator */
+	int iterator_objective;
+	float minimum[NUMBER_OF_OBJECTIVES];
+	float maximum[NUMBER_OF_OBJECTIVES];
+	struct pareto_element *element;
+	struct pareto_element *decision = NULL;
+	double distance;
+	double best_distance = INFINITY;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		minimum[iterator_objective] = INFINITY;
+		maximum[iterator_objective] = -INFINITY;
+		for (element = archive->head; element != NULL; element = element->next)
+		{
+			minimum[iterator_objective] = fminf(minimum[iterator_objective], element->key[iterator_objective]);
+			maximum[iterator_objective] = fmaxf(maximum[iterator_objective], element->key[iterator_objective]);
+		}
+	}
+	for (element = archive->head; element != NULL; element = element->next)
+	{
+		distance = 0.0;
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			if (maximum[iterator_objective] > minimum[iterator_objective])
+			{
+				distance += (element->key[iterator_objective] - minimum[iterator_objective]) /
+					(maximum[iterator_objective] - minimum[iterator_objective]);
+			}
+		}
+		if (distance < best_distance)
+		{
+			best_distance = distance;
+			decision = element;
+		}
+	}
+	return decision;
+}
+
+/* run_dynamic: replays a scenario stream online. At each time step the arrivals and departures update the instance,
+ * P_0 starts from the known Pareto set and the population of the previous time step, and the memetic algorithm runs
+ * within the budgets of the configuration. The compromise solution is applied as the live placement
+ * parameter: configuration of the run, with the scenario stream
+ * parameter: datacenter instance holding the infrastructure
+ * parameter: task pool running the per individual stages in parallel
+ * parameter: random stream of the serial stages
+ * returns: 0 if the scenario stream was replayed, 1 otherwise
+ */
+static int run_dynamic(struct configuration *configuration, struct datacenter *datacenter, struct pool *pool, struct random *random)
+{
+	struct scenario scenario;
+	struct stopping stopping;
+	/* instances and states of the memetic algorithm of the actual and previous time steps */
+	struct datacenter instances[2];
+	struct memetic memetics[2];
+	int actual = 0;
+	int has_previous = 0;
+	struct scratch *scratch;
+	struct pareto_element *decision;
+	/* placement and costs of the decision of the time step */
+	int *decision_genes;
+	float *decision_costs;
+	int iterator_individual;
+	FILE *decisions;
+	/* identificators of the virtual machines of the actual and previous time steps */
+	int *virtual_id[2];
+	/* virtual machine of the previous time step and physical machine of the live placement for each identificator */
+	int *previous_virtual;
+	int *live;
+	/* iterators */
+	int iterator_step;
+	int iterator_virtual;
+	int iterator_objective;
+	int arrivals;
+	int departures;
+	int migrations;
+	double latency;
+	double total_latency = 0.0;
+	double worst_latency = 0.0;
+	if (scenario_load(configuration->scenarios_file, &scenario) != 0)
+	{
+		return 1;
+	}
+	decisions = fopen("results/dynamic_decisions", "a");
+	if (decisions == NULL)
+	{
+		printf("[ERROR] can not open results/dynamic_decisions\n");
+		scenario_free(&scenario);
+		return 1;
+	}
+	scratch = scratch_create(0);
+	virtual_id[0] = (int *) malloc ((scenario.number_of_virtuals + 1) * sizeof (int));
+	virtual_id[1] = (int *) malloc ((scenario.number_of_virtuals + 1) * sizeof (int));
+	previous_virtual = (int *) malloc (scenario.number_of_virtuals * sizeof (int));
+	live = (int *) calloc (scenario.number_of_virtuals, sizeof (int));
+	memset(previous_virtual, -1, scenario.number_of_virtuals * sizeof (int));
+	printf("time\tvirtual\tarrivals\tdepartures\tmigrations\tgenerations\tevaluations\tpareto\tlatency_ms\n");
+	for (iterator_step = 0; iterator_step < scenario.number_of_steps; iterator_step++)
+	{
+		/* the decision latency counts from the arrival of the requests of the time step */
+		stopping_start(&stopping, configuration);
+		scenario_instance(&scenario, iterator_step, datacenter, &instances[actual], virtual_id[actual]);
+		arrivals = 0;
+		for (iterator_virtual = 0; iterator_virtual < instances[actual].v_size; iterator_virtual++)
+		{
+			if (previous_virtual[virtual_id[actual][iterator_virtual]] < 0)
+			{
+				arrivals++;
+			}
+		}
+		departures = (has_previous ? instances[1 - actual].v_size : 0) - (instances[actual].v_size - arrivals);
+		memetic_create(&memetics[actual], configuration, &instances[actual], pool, random, scratch);
+		memetic_warm_start(&memetics[actual], has_previous ? &memetics[1 - actual] : NULL, previous_virtual, virtual_id[actual],
+			random_next(random));
+		memetic_start(&memetics[actual]);
+		memetic_run(&memetics[actual], &stopping);
+		/* apply the compromise solution, the virtual machines that stay and change of physical machine are migrated */
+		decision = select_decision(memetics[actual].pareto_archive);
+		if (decision != NULL)
+		{
+			decision_genes = decision->solution;
+			decision_costs = decision->costs;
+		}
+		else
+		{
+			/* no factible placement was found: the first individual of the first front of P_t, the least overloaded */
+			for (iterator_individual = 0; memetics[actual].fronts_P[iterator_individual] != 1; iterator_individual++);
+			decision_genes = GENES(&memetics[actual].P, iterator_individual);
+			decision_costs = OBJECTIVES(&memetics[actual].P, iterator_individual);
+			printf("[WARNING] no factible placement was found at time %d, the decision overloads the datacenter\n",
+				scenario_time(&scenario, iterator_step));
+		}
+		migrations = 0;
+		for (iterator_virtual = 0; iterator_virtual < instances[actual].v_size; iterator_virtual++)
+		{
+			if (previous_virtual[virtual_id[actual][iterator_virtual]] >= 0 && live[virtual_id[actual][iterator_virtual]] != 0 &&
+				decision_genes[iterator_virtual] != 0 && decision_genes[iterator_virtual] != live[virtual_id[actual][iterator_virtual]])
+			{
+				migrations++;
+			}
+		}
+		/* the departures leave the live placement */
+		if (has_previous)
+		{
+			for (iterator_virtual = 0; iterator_virtual < instances[1 - actual].v_size; iterator_virtual++)
+			{
+				previous_virtual[virtual_id[1 - actual][iterator_virtual]] = -1;
+				live[virtual_id[1 - actual][iterator_virtual]] = 0;
+			}
+		}
+		for (iterator_virtual = 0; iterator_virtual < instances[actual].v_size; iterator_virtual++)
+		{
+			live[virtual_id[actual][iterator_virtual]] = decision_genes[iterator_virtual];
+			previous_virtual[virtual_id[actual][iterator_virtual]] = iterator_virtual;
+		}
+		latency = stopping_elapsed(&stopping);
+		total_latency += latency;
+		worst_latency = latency > worst_latency ? latency : worst_latency;
+		printf("%d\t%d\t%d\t%d\t%d\t%d\t%lld\t%d\t%.3f\n", scenario_time(&scenario, iterator_step), instances[actual].v_size,
+			arrivals, departures, migrations, memetics[actual].generation, memetics[actual].evaluations,
+			memetics[actual].pareto_archive->size, latency);
+		/* decision of the time step: time, its costs and the physical machine of each identificator, 0 if it is not placed */
+		fprintf(decisions, "%d", scenario_time(&scenario, iterator_step));
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			fprintf(decisions, "\t%g", decision_costs[iterator_objective]);
+		}
+		for (iterator_virtual = 0; iterator_virtual < scenario.number_of_virtuals; iterator_virtual++)
+		{
+			fprintf(decisions, "\t%d", live[iterator_virtual]);
+		}
+		fprintf(decisions, "\n");
+		/* the previous time step is not needed anymore */
+		if (has_previous)
+		{
+			memetic_free(&memetics[1 - actual]);
+			scenario_instance_free(&instances[1 - actual]);
+		}
+		has_previous = 1;
+		actual = 1 - actual;
+	}
+	printf("\n%d time steps, decision latency: mean %.3f ms, worst %.3f ms\n", scenario.number_of_steps,
+		total_latency / scenario.number_of_steps, worst_latency);
+	memetic_free(&memetics[1 - actual]);
+	scenario_instance_free(&instances[1 - actual]);
+	fclose(decisions);
+	free(virtual_id[0]);
+	free(virtual_id[1]);
+	free(previous_virtual);
+	free(live);
+	scratch_free(scratch);
+	scenario_free(&scenario);
+	return 0;
+}
+
+/* check_instance: checks if the problem instance has at least one solution, placing its mandatory virtual machines
+ * parameter: configuration of the run
+ * parameter: datacenter instance
+ * returns: the reason of the answer, FEASIBILITY_FEASIBLE to FEASIBILITY_LOWER_BOUND
+ */
+static int check_instance(struct configuration *configuration, struct datacenter *datacenter)
+{
+	struct feasibility_report report;
+	struct objective_bounds bounds;
+	/* iterators */
+	int iterator_resource;
+	int iterator_objective;
+	feasibility_check(datacenter, configuration->max_SLA, &report);
+	if (configuration->check_only)
+	{
+		printf("reason %s mandatory %d placed %d physical %d/%d milliseconds %.3f\n", feasibility_reason(report.reason),
+			report.number_of_mandatory, report.placed, report.physical_used, datacenter->h_size, report.milliseconds);
+		for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+		{
+			printf("resource %d demand %lld capacity %lld lower-bound %d\n", iterator_resource, report.demand[iterator_resource],
+				report.capacity[iterator_resource], report.lower_bound[iterator_resource]);
+		}
+		objective_bounds_compute(datacenter, configuration->max_SLA, &bounds);
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			printf("objective %d ideal %g nadir %g\n", iterator_objective + 1, bounds.ideal[iterator_objective],
+				bounds.nadir[iterator_objective]);
+		}
+	}
+	switch (report.reason)
+	{
+		case FEASIBILITY_UNKNOWN:
+			printf("[WARNING] the mandatory virtual machines could not be placed by first fit decreasing, virtual machine %d left\n",
+				report.virtual);
+			break;
+		case FEASIBILITY_OVERSIZED:
+			printf("[ERROR] the mandatory virtual machine %d fits in no physical machine\n", report.virtual);
+			break;
+		case FEASIBILITY_CAPACITY:
+			printf("[ERROR] the mandatory virtual machines need %lld of resource %d, the datacenter has %lld\n",
+				report.demand[report.resource], report.resource, report.capacity[report.resource]);
+			break;
+		case FEASIBILITY_LOWER_BOUND:
+			printf("[ERROR] the mandatory virtual machines need more than %d physical machines for resource %d\n",
+				datacenter->h_size, report.resource);
+			break;
+	}
+	return report.reason;
+}
 
 /* main: Interactive Memetic Algorithm for Virtual Machine Placement (IMAVMP)
  * parameter: path to the datacenter infrastructure file
+ * parameter: seed of the random numbers, optional, the actual time by default
+ * parameter: --config file and --key value settings, see config_usage()
  * returns: exit state
  */
 int main (int argc, char *argv[]) {
+	/* configuration of the run: defaults, then the configuration file, then the command line */
+	struct configuration configuration;
+	config_defaults(&configuration);
     /* parameters verification */
-	if (argc == 1)
+	if (config_parse_arguments(&configuration, argc, argv) != 0)
 	{
 		/* wrong parameters */	
-		printf("[ERROR] usage: %s datacenter_file\n", argv[0]);
+		config_usage(argv[0]);
 		/* finish him */
 		return 1;
 	}
@@ -50,149 +685,103 @@ int main (int argc, char *argv[]) {
 	else
 	{
 		/* Interactive Memetic Algorithm previous stuff */
-		/* number of generation, for iterative reference of generations */
-		int generation = 0;
-		/* get the number of physical machines, virtual machines and network links from the datacenter infrastructure file (argv[1]) */
-		int h_size = get_h_size(argv[1]);
-		int v_size = get_v_size(argv[1]);
-		int l_size = get_l_size(argv[1]);
-		// printf("\nH=%d, V=%d, L=%d\n",h_size,v_size,l_size);
-		/* load physical machines resources, virtual machines requirements and network topology from the datacenter infrastructure file */
-		int **H = load_H(h_size, argv[1]);
-		// printf("\nH LOADED SUCCESSFULLY\n");
-		int **V = load_V(v_size, argv[1]);	
-		// printf("\nV LOADED SUCCESSFULLY\n");
-		int **T = load_T(v_size, argv[1]);
-		// printf("\nT LOADED SUCCESSFULLY\n");
-		int **G = load_G(h_size, l_size, argv[1]);
-		// printf("\nG LOADED SUCCESSFULLY\n");
-		int *K 	= load_K(l_size, argv[1]);
-		// printf("\nK LOADED SUCCESSFULLY\n");
-		/* seed for rand() */
-		srand((unsigned int) time(NULL));
-		/* randon value of 0-1 */
-		srand48(time(NULL));
+		/* the budgets count from here, the loading of the datacenter included */
+		struct stopping stopping;
+		stopping_start(&stopping, &configuration);
+		char *datacenter_file = configuration.datacenter_file;
+		int result;
+		/* load physical machines resources, virtual machines requirements and network topology from the datacenter infrastructure file,
+		 * as the datacenter instance shared by the stages that evaluate placements incrementally */
+		struct datacenter datacenter;
+		if (load_datacenter(datacenter_file, &datacenter) != 0)
+		{
+			return 1;
+		}
+		/* task pool running the per individual stages in parallel */
+		struct pool *pool = pool_create(configuration.number_of_threads);
+		/* random stream of the serial stages, it also draws the seed of each parallel stage.
+		The same seed gives the same results whatever the number of threads */
+		struct random random;
+		random_seed(&random, configuration.seed, 0);
 		// printf("\nDATACENTER LOADED SUCCESSFULLY\n");
 
 		/* Interactive Memetic Algorithm starts here */
-		/* 01: Check if the problem has a solution */
-		if (check_instance() != 0)
+		/* 01: Check if the problem has a solution: only a proof of infeasibility stops the run */
+		result = check_instance(&configuration, &datacenter);
+		if (configuration.check_only)
+		{
+			pool_free(pool);
+			datacenter_free(&datacenter);
+			return result;
+		}
+		if (result > FEASIBILITY_UNKNOWN)
 		{
 			/* no solution was found */
 			printf("\nThe problem has no solution, call Amazon EC2\n");
 			return 1;
 		}
 		/* the problem instance have at least one solution, so we can continue */
+		/* online mode: the scenario stream is replayed over the infrastructure of the datacenter */
+		if (configuration.scenarios_file[0] != '\0')
+		{
+			result = run_dynamic(&configuration, &datacenter, pool, &random);
+			pool_free(pool);
+			datacenter_free(&datacenter);
+			return result;
+		}
+		/* Additional task: temporary arrays of the stages, released at the end of each generation */
+		struct scratch *scratch = scratch_create(0);
+		struct memetic memetic;
+		int number_of_seeds = 0;
+		memetic_create(&memetic, &configuration, &datacenter, pool, &random, scratch);
 		/* 02: Initialize population P_0 */
-		int **P = initialization(NUMBER_OF_INDIVIDUALS, h_size, v_size, V, MAX_SLA);
+		initialization(&memetic.P, datacenter.V, configuration.max_SLA, random_next(&random), pool);
 		// printf("\nP_0 CREATED SUCCESSFULLY\n");
-		/* Additional task: load the utilization of physical machines and network links of all individuals/solutions */
-		int ***utilization_P = load_utilization(P, H, V, NUMBER_OF_INDIVIDUALS, h_size, v_size);
-		// printf("\nP_0 UTILIZATION CALCULATED SUCCESSFULLY\n");
-		int **network_utilization_P = load_network_utilization(P, G, T, NUMBER_OF_INDIVIDUALS, l_size, v_size);
-		// printf("\nP_0 NETWORK UTILIZATION CALCULATED SUCCESSFULLY\n");
-		/* 03: P0’ = repair infeasible solutions of P_0 */
-		P = reparation(P, utilization_P, H, V, NUMBER_OF_INDIVIDUALS, h_size, v_size, MAX_SLA, K, network_utilization_P, l_size, G, T);
-		// printf("\nP_0 REPAIRED SUCCESSFULLY\n");
-		/* 04: P0’’ = apply local search to solutions of P_0’ */
-		//P = local_search(P, utilization_P, H, V, NUMBER_OF_INDIVIDUALS, h_size, v_size);
-		/* Additional task: calculate the cost of each objective function for each solution */
-		float **objectives_functions_P = load_objectives(P, utilization_P, H, V, T, NUMBER_OF_INDIVIDUALS, h_size, v_size, K, network_utilization_P, l_size);
-		// printf("\nP_0 OBJECTIVE FUNCTIONS VALUES CALCULATED SUCCESSFULLY\n");
-		/* Additional task: calculate the non-dominated fronts according to NSGA-II */
-		int *fronts_P = non_dominated_sorting(objectives_functions_P,NUMBER_OF_INDIVIDUALS);
-		// printf("\nP_0 NON-DOMINATED SORTING CALCULATED SUCCESSFULLY\n");
-		/* 05: Update set of nondominated solutions Pc from P_0’’ */
-		struct pareto_element *pareto_head = NULL;
-		int iterator_individual;
-		/* considering that the P_c is empty at first population, each non-dominated solution from first front is added */
-		for (iterator_individual = 0 ; iterator_individual < NUMBER_OF_INDIVIDUALS ; iterator_individual++)
-		{
-		 	if(fronts_P[iterator_individual] == 1)
-		 	{
-		 		pareto_head = (struct pareto_element *) pareto_insert(pareto_head,v_size,P[iterator_individual],objectives_functions_P[iterator_individual]);
-		 	}
+		/* Additional task: P_0 starts from the known Pareto set of a previous run, the rest of it stays random */
+		if (configuration.seed_set_file[0] != '\0' && (number_of_seeds = memetic_seed(&memetic, configuration.seed_set_file)) < 0)
+		{
+			return 1;
 		}
-		// printf("\nP_KNOWN CALCULATED SUCCESSFULLY\n");
-		/* 06: t = 0 */
-		/* 06: Pt = P0’’ */
-		/* Additional task: identificators for the crossover parents */
-		int father, mother;
-		/* Additional task: structures for Q and PQ */
-		int **Q;
-		int ***utilization_Q;
-		int **network_utilization_Q;
-		float **objectives_functions_Q;
-		int *fronts_Q;
-		/* 07: While (stopping criterion is not met), do */
-		while (generation < NUMBER_OF_GENERATIONS)
-		{
-			// printf("\nGENERATION %d STARTED SUCCESSFULLY\n",generation);
-			/* this is a new generation! */
-			generation++;
-		 	/* Additional task: Q is a random generated population, lets initialize it */
-			Q = initialization(NUMBER_OF_INDIVIDUALS, h_size, v_size, V, MAX_SLA);
-			/* 08: Q_t = selection of solutions from P_t ∪ P_c */
-			father = selection(fronts_P, NUMBER_OF_INDIVIDUALS, SELECTION_PERCENT);
-			mother = selection(fronts_P, NUMBER_OF_INDIVIDUALS, SELECTION_PERCENT);
-			// printf("\nSELECTION SUCCESSFULL\n");
-			/* 09: Q_t’ = crossover and mutation of solutions of Q_t */
-			Q = crossover(Q, father, mother, v_size);
-			// printf("\nCROSSOVER SUCCESSFULL\n");
-			/* 10: Q_t’ = crossover and mutation of solutions of Q_t */
-			// printf("\nMUTATION SUCCESSFULL\n");
-			Q = mutation(Q,V,NUMBER_OF_INDIVIDUALS,h_size,v_size);
-			/* Additional task: load the utilization of physical machines and network links of all individuals/solutions */
-			utilization_Q = load_utilization(Q, H, V, NUMBER_OF_INDIVIDUALS, h_size, v_size);
-			// printf("\nP_%d UTILIZATION CALCULATED SUCCESSFULLY\n",generation);
-			network_utilization_Q = load_network_utilization(Q, G, T, NUMBER_OF_INDIVIDUALS, l_size, v_size);
-			// printf("\nP_%d NETWORK UTILIZATION CALCULATED SUCCESSFULLY\n",generation);
-			/* 10: Q_t’’ = repair infeasible solutions of Q_t’ */
-			Q = reparation(Q, utilization_Q, H, V, NUMBER_OF_INDIVIDUALS, h_size, v_size, MAX_SLA, K, network_utilization_Q, l_size, G, T);
-			// printf("\nP_%d REPAIRED SUCCESSFULLY\n",generation);
-			/* 11: Q_t’’’ = apply local search to solutions of Q_t’’ */
-			//Q = local_search(Q, utilization_Q, H, V, NUMBER_OF_INDIVIDUALS, h_size, v_size);
-			/* Additional task: calculate the cost of each objective function for each solution */
-			objectives_functions_Q = load_objectives(Q, utilization_Q, H, V, T, NUMBER_OF_INDIVIDUALS, h_size, v_size, K, network_utilization_Q, l_size);
-			// printf("\nP_%d OBJECTIVE FUNCTIONS VALUES CALCULATED SUCCESSFULLY\n",generation);
-			/* Additional task: calculate the non-dominated fronts according to NSGA-II */
-			fronts_Q = non_dominated_sorting(objectives_functions_Q,NUMBER_OF_INDIVIDUALS);
-			// printf("\nP_%d NON-DOMINATED SORTING CALCULATED SUCCESSFULLY\n",generation);
-			/* 12: Update set of nondominated solutions Pc from Qt’’’ */
-			for (iterator_individual = 0 ; iterator_individual < NUMBER_OF_INDIVIDUALS ; iterator_individual++)
-		    	{
-			 	if(fronts_Q[iterator_individual] == 1)
-			 	{
-			 		pareto_head = (struct pareto_element *) pareto_insert(pareto_head,v_size,Q[iterator_individual],objectives_functions_Q[iterator_individual]);
-			 	}
+		/* Additional task: part of the rest of P_0 can be built by constructive heuristics, so the repair has less to do */
+		memetic_construct(&memetic, number_of_seeds);
+		memetic_start(&memetic);
+		/* Additional task: the known Pareto front is sampled along the run, for the convergence benchmark */
+		if (configuration.trace_interval > 0.0)
+		{
+			memetic.trace = fopen("results/convergence_trace", "a");
+			if (memetic.trace == NULL)
+			{
+				printf("[ERROR] can not open results/convergence_trace\n");
+				return 1;
 			}
-			// printf("\nP_KNOWN CALCULATED SUCCESSFULLY\n");
-			/* 17: Pt = fitness selection from Pt ∪ Qt’’’ */
-			P = population_evolution(P, Q, objectives_functions_P, objectives_functions_Q, fronts_P, NUMBER_OF_INDIVIDUALS, v_size);
-			// printf("\nP_%d EVOLVED TO P_%d\n",generation-1,generation);
-		}
-		//printf("min cost f1: %g\n",get_min_cost(pareto_head, 0));
-		//printf("max cost f1: %g\n",get_max_cost(pareto_head, 0));
-		//printf("min cost f2: %g\n",get_min_cost(pareto_head, 1));
-		//printf("max cost f2: %g\n",get_max_cost(pareto_head, 1));
-		//printf("min cost f3: %g\n",get_min_cost(pareto_head, 2));
-		//printf("max cost f3: %g\n",get_max_cost(pareto_head, 2));
-		//printf("min cost f4: %g\n",get_min_cost(pareto_head, 3));
-		//printf("max cost f4: %g\n",get_max_cost(pareto_head, 3));
-		//printf("min cost f5: %g\n",get_min_cost(pareto_head, 4));
-		//printf("max cost f5: %g\n",get_max_cost(pareto_head, 4));
-		report_best_population(pareto_head, G, T, H, V, v_size, h_size, l_size);
+		}
+		memetic_run(&memetic, &stopping);
+		if (memetic.trace != NULL)
+		{
+			fclose(memetic.trace);
+		}
+		//printf("min cost f1: %g\n",get_min_cost(memetic.pareto_archive->head, 0));
+		//printf("max cost f1: %g\n",get_max_cost(memetic.pareto_archive->head, 0));
+		//printf("min cost f2: %g\n",get_min_cost(memetic.pareto_archive->head, 1));
+		//printf("max cost f2: %g\n",get_max_cost(memetic.pareto_archive->head, 1));
+		//printf("min cost f3: %g\n",get_min_cost(memetic.pareto_archive->head, 2));
+		//printf("max cost f3: %g\n",get_max_cost(memetic.pareto_archive->head, 2));
+		//printf("min cost f4: %g\n",get_min_cost(memetic.pareto_archive->head, 3));
+		//printf("max cost f4: %g\n",get_max_cost(memetic.pareto_archive->head, 3));
+		//printf("min cost f5: %g\n",get_min_cost(memetic.pareto_archive->head, 4));
+		//printf("max cost f5: %g\n",get_max_cost(memetic.pareto_archive->head, 4));
+		if (memetic.pareto_archive->size == 0)
+		{
+			printf("[WARNING] no factible placement was found, the known Pareto set is empty\n");
+		}
+		report_best_population(memetic.pareto_archive->head, datacenter.topology, datacenter.T, datacenter.V,
+			datacenter.v_size, datacenter.h_size, datacenter.l_size);
 		printf("\n");
+		pool_free(pool);
+		scratch_free(scratch);
+		memetic_free(&memetic);
+		datacenter_free(&datacenter);
 		/* finish him */
 		return 0;
 	}
 }
-
-/* check_instance: checks if the problem instance has at least one solution
- * returns: 1 if there is no solution, 0 if the is at least one solution
- */
-int check_instance()
-{
-	/* this return alllways 0 for now (this could be implemented this to check if a problem instance have at least one solution) */
-	return 0;
-}
@@ -0,0 +1,355 @@
+/*
+ * indicators.c: Virtual Machine Placement Problem - Quality Indicators
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include quality indicators header */
+#include "indicators.h"
+
+/* inclusive_hypervolume: volume dominated by a single point
+ * parameter: point, every objective is minimized
+ * parameter: reference point
+ * returns: volume of the box between the point and the reference point
+ */
+static double inclusive_hypervolume(const float *point, const float *reference)
+{
+	/* iterator */
+	int iterator_objective;
+	double volume = 1.0;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		if (point[iterator_objective] >= reference[iterator_objective])
+		{
+			return 0.0;
+		}
+		volume *= (double) reference[iterator_objective] - point[iterator_objective];
+	}
+	return volume;
+}
+
+/* non_dominated_points: removes in place the points weakly dominated by another point
+ * parameter: points, every objective is minimized
+ * parameter: number of points
+ * returns: number of points left
+ */
+int non_dominated_points(float *points, int number_of_points)
+{
+	/* iterators */
+	int iterator_point;
+	int iterator_other;
+	int iterator_objective;
+	int worse;
+	int better;
+	for (iterator_point = 0; iterator_point < number_of_points; iterator_point++)
+	{
+		for (iterator_other = 0; iterator_other < number_of_points; iterator_other++)
+		{
+			if (iterator_other == iterator_point)
+			{
+				continue;
+			}
+			worse = 0;
+			better = 0;
+			for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+			{
+				worse |= points[iterator_other * NUMBER_OF_OBJECTIVES + iterator_objective] > points[iterator_point * NUMBER_OF_OBJECTIVES + iterator_objective];
+				better |= points[iterator_other * NUMBER_OF_OBJECTIVES + iterator_objective] < points[iterator_point * NUMBER_OF_OBJECTIVES + iterator_objective];
+			}
+			/* the point is dominated, or equal to a point kept before it */
+			if (!worse && (better || iterator_other < iterator_point))
+			{
+				memcpy(points + iterator_point * NUMBER_OF_OBJECTIVES, points + (number_of_points - 1) * NUMBER_OF_OBJECTIVES,
+					NUMBER_OF_OBJECTIVES * sizeof (float));
+				number_of_points--;
+				iterator_point--;
+				break;
+			}
+		}
+	}
+	return number_of_points;
+}
+
+/* hypervolume: exact hypervolume with the WFG algorithm of While et al.
+ * parameter: points, every objective is minimized
+ * parameter: number of points
+ * parameter: reference point
+ * parameter: scratch arena for the limits of each level of the recursion, NULL to allocate them for this call
+ * returns: volume dominated by the points and bounded by the reference point
+ */
+double hypervolume(const float *keys, int number_of_points, const float *reference, struct scratch *scratch)
+{
+	/* iterators */
+	int iterator_point;
+	int iterator_other;
+	int iterator_objective;
+	int number_of_limits;
+	double volume = 0.0;
+	/* points limited by the actual point, the part of the volume they share with it */
+	float *limits;
+	struct scratch *temporary = NULL;
+	size_t mark;
+	if (number_of_points == 0)
+	{
+		return 0.0;
+	}
+	if (number_of_points == 1)
+	{
+		return inclusive_hypervolume(keys, reference);
+	}
+	if (scratch == NULL)
+	{
+		scratch = temporary = scratch_create(0);
+	}
+	mark = scratch_mark(scratch);
+	limits = (float *) scratch_alloc (scratch, (size_t) number_of_points * NUMBER_OF_OBJECTIVES * sizeof (float));
+	/* the volume of each point minus the volume it shares with the points after it */
+	for (iterator_point = 0; iterator_point < number_of_points; iterator_point++)
+	{
+		number_of_limits = 0;
+		for (iterator_other = iterator_point + 1; iterator_other < number_of_points; iterator_other++)
+		{
+			for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+			{
+				limits[number_of_limits * NUMBER_OF_OBJECTIVES + iterator_objective] =
+					keys[iterator_point * NUMBER_OF_OBJECTIVES + iterator_objective] > keys[iterator_other * NUMBER_OF_OBJECTIVES + iterator_objective] ?
+					keys[iterator_point * NUMBER_OF_OBJECTIVES + iterator_objective] : keys[iterator_other * NUMBER_OF_OBJECTIVES + iterator_objective];
+			}
+			number_of_limits++;
+		}
+		number_of_limits = non_dominated_points(limits, number_of_limits);
+		volume += inclusive_hypervolume(keys + iterator_point * NUMBER_OF_OBJECTIVES, reference) -
+			hypervolume(limits, number_of_limits, reference, scratch);
+	}
+	scratch_release(scratch, mark);
+	scratch_free(temporary);
+	return volume;
+}
+
+/* sample_box: draws a point uniformly between the ideal point of a set and a reference point
+ * parameter: ideal point
+ * parameter: reference point
+ * parameter: sample to fill
+ * parameter: state of the random generator
+ * returns: nothing, it's void
+ */
+static void sample_box(const float *ideal, const float *reference, float *sample, unsigned short *state)
+{
+	/* iterator */
+	int iterator_objective;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		sample[iterator_objective] = ideal[iterator_objective] + (float) erand48(state) * (reference[iterator_objective] - ideal[iterator_objective]);
+	}
+}
+
+/* sampling_box: ideal point of a set of points and volume of the box up to the reference point
+ * parameter: points, every objective is minimized
+ * parameter: number of points
+ * parameter: reference point
+ * parameter: ideal point to fill
+ * returns: volume of the sampling box
+ */
+static double sampling_box(const float *keys, int number_of_points, const float *reference, float *ideal)
+{
+	/* iterators */
+	int iterator_point;
+	int iterator_objective;
+	double volume = 1.0;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		ideal[iterator_objective] = reference[iterator_objective];
+		for (iterator_point = 0; iterator_point < number_of_points; iterator_point++)
+		{
+			if (keys[iterator_point * NUMBER_OF_OBJECTIVES + iterator_objective] < ideal[iterator_objective])
+			{
+				ideal[iterator_objective] = keys[iterator_point * NUMBER_OF_OBJECTIVES + iterator_objective];
+			}
+		}
+		volume *= (double) reference[iterator_objective] - ideal[iterator_objective];
+	}
+	return volume;
+}
+
+/* dominates_sample: checks if a point is no worse than a sample in every objective
+ * parameter: point
+ * parameter: sample
+ * returns: 1 if the sample is inside the volume of the point, 0 otherwise
+ */
+static int dominates_sample(const float *point, const float *sample)
+{
+	/* iterator */
+	int iterator_objective;
+	int worse = 0;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		worse |= point[iterator_objective] > sample[iterator_objective];
+	}
+	return !worse;
+}
+
+/* hypervolume_monte_carlo: approximated hypervolume by uniform sampling
+ * parameter: points, every objective is minimized
+ * parameter: number of points
+ * parameter: lower corner of the sampling box, NULL for the ideal point of the set. A fixed box
+ *            and state give the same samples on every call, so the values of two sets are comparable
+ * parameter: reference point
+ * parameter: number of samples
+ * parameter: state of the random generator, for erand48
+ * returns: approximated volume dominated by the points inside the box
+ */
+double hypervolume_monte_carlo(const float *keys, int number_of_points, const float *lower, const float *reference, int number_of_samples, unsigned short *state)
+{
+	/* iterators */
+	int iterator_sample;
+	int iterator_point;
+	int iterator_objective;
+	int dominated = 0;
+	float ideal[NUMBER_OF_OBJECTIVES];
+	float sample[NUMBER_OF_OBJECTIVES];
+	double volume = sampling_box(keys, number_of_points, reference, ideal);
+	if (lower != NULL)
+	{
+		volume = 1.0;
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			ideal[iterator_objective] = lower[iterator_objective];
+			volume *= (double) reference[iterator_objective] - lower[iterator_objective];
+		}
+	}
+	for (iterator_sample = 0; iterator_sample < number_of_samples; iterator_sample++)
+	{
+		sample_box(ideal, reference, sample, state);
+		for (iterator_point = 0; iterator_point < number_of_points; iterator_point++)
+		{
+			if (dominates_sample(keys + iterator_point * NUMBER_OF_OBJECTIVES, sample))
+			{
+				dominated++;
+				break;
+			}
+		}
+	}
+	return volume * dominated / number_of_samples;
+}
+
+/* hypervolume_contributions: volume dominated only by each point, exact for small sets and sampled otherwise
+ * parameter: points, every objective is minimized
+ * parameter: number of points
+ * parameter: reference point
+ * parameter: array of contributions to fill
+ * parameter: state of the random generator, for erand48
+ * parameter: scratch arena for the exact volumes, NULL to allocate them for this call
+ * returns: nothing, it's void
+ */
+void hypervolume_contributions(const float *keys, int number_of_points, const float *reference, double *contributions, unsigned short *state,
+	struct scratch *scratch)
+{
+	/* iterators */
+	int iterator_sample;
+	int iterator_point;
+	int dominator;
+	int number_of_dominators;
+	float ideal[NUMBER_OF_OBJECTIVES];
+	float sample[NUMBER_OF_OBJECTIVES];
+	float *others;
+	double volume;
+	struct scratch *temporary = NULL;
+	size_t mark;
+	if (number_of_points <= HV_EXACT_LIMIT)
+	{
+		if (scratch == NULL)
+		{
+			scratch = temporary = scratch_create(0);
+		}
+		mark = scratch_mark(scratch);
+		/* exact: the volume of the set minus the volume of the set without the point */
+		others = (float *) scratch_alloc (scratch, ((size_t) number_of_points * NUMBER_OF_OBJECTIVES + 1) * sizeof (float));
+		volume = hypervolume(keys, number_of_points, reference, scratch);
+		for (iterator_point = 0; iterator_point < number_of_points; iterator_point++)
+		{
+			memcpy(others, keys, (size_t) number_of_points * NUMBER_OF_OBJECTIVES * sizeof (float));
+			memcpy(others + iterator_point * NUMBER_OF_OBJECTIVES, keys + (number_of_points - 1) * NUMBER_OF_OBJECTIVES,
+				NUMBER_OF_OBJECTIVES * sizeof (float));
+			contributions[iterator_point] = volume - hypervolume(others, number_of_points - 1, reference, scratch);
+		}
+		scratch_release(scratch, mark);
+		scratch_free(temporary);
+		return;
+	}
+	/* sampled: a sample inside the volume of a single point belongs to its contribution */
+	volume = sampling_box(keys, number_of_points, reference, ideal);
+	memset(contributions, 0, number_of_points * sizeof (double));
+	for (iterator_sample = 0; iterator_sample < HV_SAMPLES; iterator_sample++)
+	{
+		sample_box(ideal, reference, sample, state);
+		number_of_dominators = 0;
+		dominator = -1;
+		for (iterator_point = 0; iterator_point < number_of_points && number_of_dominators < 2; iterator_point++)
+		{
+			if (dominates_sample(keys + iterator_point * NUMBER_OF_OBJECTIVES, sample))
+			{
+				number_of_dominators++;
+				dominator = iterator_point;
+			}
+		}
+		if (number_of_dominators == 1)
+		{
+			contributions[dominator] += volume / HV_SAMPLES;
+		}
+	}
+}
+
+/* crowding_distances: crowding distance of NSGA-II of each point of a non-dominated set
+ * parameter: points, every objective is minimized
+ * parameter: number of points
+ * parameter: array of distances to fill, INFINITY for the extreme points
+ * parameter: array of number of points integers for the order of the points, NULL to allocate it for this call
+ * returns: nothing, it's void
+ */
+void crowding_distances(const float *keys, int number_of_points, double *distances, int *order)
+{
+	/* iterators */
+	int iterator_point;
+	int iterator_objective;
+	int iterator_sorted;
+	int point;
+	double range;
+	/* points sorted by the actual objective */
+	int *allocated = order == NULL ? (int *) malloc ((number_of_points + 1) * sizeof (int)) : NULL;
+	if (allocated != NULL)
+	{
+		order = allocated;
+	}
+	memset(distances, 0, number_of_points * sizeof (double));
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		/* insertion sort, the archives are small and mostly sorted between calls */
+		for (iterator_point = 0; iterator_point < number_of_points; iterator_point++)
+		{
+			point = iterator_point;
+			for (iterator_sorted = iterator_point; iterator_sorted > 0 &&
+				keys[order[iterator_sorted - 1] * NUMBER_OF_OBJECTIVES + iterator_objective] > keys[point * NUMBER_OF_OBJECTIVES + iterator_objective]; iterator_sorted--)
+			{
+				order[iterator_sorted] = order[iterator_sorted - 1];
+			}
+			order[iterator_sorted] = point;
+		}
+		if (number_of_points == 0)
+		{
+			break;
+		}
+		distances[order[0]] = INFINITY;
+		distances[order[number_of_points - 1]] = INFINITY;
+		range = (double) keys[order[number_of_points - 1] * NUMBER_OF_OBJECTIVES + iterator_objective] - keys[order[0] * NUMBER_OF_OBJECTIVES + iterator_objective];
+		if (range <= 0.0)
+		{
+			continue;
+		}
+		for (iterator_sorted = 1; iterator_sorted < number_of_points - 1; iterator_sorted++)
+		{
+			distances[order[iterator_sorted]] += ((double) keys[order[iterator_sorted + 1] * NUMBER_OF_OBJECTIVES + iterator_objective] -
+				keys[order[iterator_sorted - 1] * NUMBER_OF_OBJECTIVES + iterator_objective]) / range;
+		}
+	}
+	free(allocated);
+}
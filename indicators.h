@@ -0,0 +1,31 @@
+/*
+ * indicators.h: Virtual Machine Placement Problem - Quality Indicators Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef INDICATORS_H
+#define INDICATORS_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include population arena header */
+#include "population.h"
+#include "scratch.h"
+/* definitions */
+#define HV_EXACT_LIMIT 32
+#define HV_SAMPLES 4096
+
+/* function headers definitions */
+int non_dominated_points(float *points, int number_of_points);
+double hypervolume(const float *keys, int number_of_points, const float *reference, struct scratch *scratch);
+double hypervolume_monte_carlo(const float *keys, int number_of_points, const float *lower, const float *reference, int number_of_samples, unsigned short *state);
+void hypervolume_contributions(const float *keys, int number_of_points, const float *reference, double *contributions, unsigned short *state,
+	struct scratch *scratch);
+void crowding_distances(const float *keys, int number_of_points, double *distances, int *order);
+
+#endif
@@ -8,61 +8,443 @@
 /* include initialization stage header */
 #include "initialization.h"
 
-/* initialization: initializes a population randomically
- * parameter: number of individuals
- * parameter: number of physical machines
- * parameter: number of virtual machines
- * parameter: virtual machines requirements matrix
- * returns: population matrix
+/* context of the initialization task */
+struct initialization_context
+{
+	struct population *population;
+	int **V;
+	int max_SLA;
+	unsigned long long seed;
+};
+
+/* initialization_task: initializes a range of individuals randomically, each one from its own random stream
+ * parameter: initialization context
+ * parameter: first individual
+ * parameter: end of the range of individuals
+ * parameter: thread running the task
+ * returns: nothing, it's void
  */
-int** initialization(int number_of_individuals, int h_size, int v_size, int **V, int max_SLA)
+static void initialization_task(void *context, int begin, int end, int thread)
 {
-	/* population: initial population matrix */
-	int **population = (int **) malloc (number_of_individuals *sizeof (int *));
+	struct population *population = ((struct initialization_context *) context)->population;
+	int **V = ((struct initialization_context *) context)->V;
+	int max_SLA = ((struct initialization_context *) context)->max_SLA;
 	/* iterators */
 	int iterator_individual;
 	int iterator_individual_position;
+	/* genes of the current individual */
+	int *individual;
+	/* random stream of the current individual */
+	struct random random;
+	/* the stage needs no scratch, so it ignores the thread running it */
+	(void) thread;
 	/* iterate on individuals */
-	for (iterator_individual=0; iterator_individual < number_of_individuals; iterator_individual++)
+	for (iterator_individual = begin; iterator_individual < end; iterator_individual++)
 	{
-		population[iterator_individual] = (int *) malloc (v_size *sizeof (int));
+		individual = GENES(population, iterator_individual);
+		random_seed(&random, ((struct initialization_context *) context)->seed, iterator_individual);
 		/* iterate on positions of an individual */
-		for (iterator_individual_position = 0; iterator_individual_position < v_size; iterator_individual_position++)
+		for (iterator_individual_position = 0; iterator_individual_position < population->v_size; iterator_individual_position++)
 		{
 			/* individual with SLA != max_SLA */
 			if (V[iterator_individual_position][3] != max_SLA)
 			{
 				/* assign to each virtual machine a random generated physical machine */
-				population[iterator_individual][iterator_individual_position] = generate_solution_position(h_size, 0);
+				individual[iterator_individual_position] = generate_solution_position(&random, population->h_size, 0);
 			} 
 			/* individual with SLA == max_SLA */
 			if (V[iterator_individual_position][3] == max_SLA)
 			{
 				/* assign to each virtual machine a random generated physical machine */
-				population[iterator_individual][iterator_individual_position] = generate_solution_position(h_size, 1);
+				individual[iterator_individual_position] = generate_solution_position(&random, population->h_size, 1);
+			}
+		}
+	}
+}
+
+/* initialization: initializes a population randomically
+ * parameter: population arena to initialize
+ * parameter: virtual machines requirements matrix
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: seed of the random streams of the individuals
+ * parameter: task pool running the individuals in parallel, NULL to run them on the calling thread
+ * returns: nothing, it's void
+ */
+void initialization(struct population *population, int **V, int max_SLA, unsigned long long seed, struct pool *pool)
+{
+	struct initialization_context context = {population, V, max_SLA, seed};
+	pool_run(pool, population->number_of_individuals, POOL_AUTO_CHUNK, initialization_task, &context);
+}
+
+/* workspace of the constructions of a thread */
+struct construction_workspace
+{
+	struct capacity_index *index;
+	/* evaluation state, it tracks the utilization of the network links of the individual */
+	struct evaluation *evaluation;
+	/* virtual machines in placement order, and their noisy sizes */
+	int *order;
+	float *size;
+	/* physical machines by decreasing power efficiency, and their noisy consumption per unit of Processor */
+	int *physical_order;
+	float *consumption;
+};
+
+/* context of the construction task */
+struct construction_context
+{
+	struct population *population;
+	struct datacenter *datacenter;
+	int max_SLA;
+	/* first individual to build, the ones before it are kept */
+	int first_individual;
+	unsigned long long seed;
+	struct construction_workspace *workspaces;
+};
+
+/* sort_decreasing: sorts identificators by decreasing key, with a shell sort that needs no memory
+ * parameter: identificators to sort
+ * parameter: key of each identificator
+ * parameter: number of identificators
+ * returns: nothing, it's void
+ */
+static void sort_decreasing(int *order, float *key, int size)
+{
+	/* iterators */
+	int iterator_element;
+	int iterator_position;
+	int gap;
+	int element;
+	for (gap = 1; gap < size / 3; gap = 3 * gap + 1);
+	for (; gap > 0; gap /= 3)
+	{
+		for (iterator_element = gap; iterator_element < size; iterator_element++)
+		{
+			element = order[iterator_element];
+			for (iterator_position = iterator_element; iterator_position >= gap && key[order[iterator_position - gap]] < key[element];
+				iterator_position -= gap)
+			{
+				order[iterator_position] = order[iterator_position - gap];
+			}
+			order[iterator_position] = element;
+		}
+	}
+}
+
+/* place_virtual: places a virtual machine in a constructed individual, unless its traffic with the placed peers
+ * overloads the network links any further
+ * parameter: workspace, attached to the individual
+ * parameter: identificator of the virtual machine
+ * parameter: identificator of the physical machine
+ * parameter: 1 to place the virtual machine even if it overloads the network links, for the repair
+ * returns: 1 if the virtual machine was placed, 0 otherwise
+ */
+static int place_virtual(struct construction_workspace *workspace, int virtual, int physical, int forced)
+{
+	struct evaluation *evaluation = workspace->evaluation;
+	long long link_excess = evaluation->link_excess;
+	evaluation_move_vm(evaluation, virtual, physical + 1);
+	if (!forced && evaluation->link_excess > link_excess)
+	{
+		evaluation_move_vm(evaluation, virtual, 0);
+		return 0;
+	}
+	capacity_index_update(workspace->index, physical);
+	return 1;
+}
+
+/* heaviest_placed_peer: finds the physical machine of the placed peer a virtual machine exchanges the most traffic
+ * with, among the ones the virtual machine fits in
+ * parameter: datacenter instance
+ * parameter: workspace, attached to the individual
+ * parameter: identificator of the virtual machine
+ * returns: the physical machine, -1 if there is none
+ */
+static int heaviest_placed_peer(struct datacenter *datacenter, struct construction_workspace *workspace, int virtual)
+{
+	struct traffic_matrix *T = datacenter->T;
+	int *genes = workspace->evaluation->genes;
+	/* iterator */
+	int iterator_pair;
+	int physical_position;
+	int found = -1;
+	traffic_t found_traffic = 0;
+	for (iterator_pair = T->row_start[virtual]; iterator_pair < T->row_start[virtual + 1]; iterator_pair++)
+	{
+		physical_position = genes[T->column[iterator_pair]];
+		if (physical_position != 0 && T->value[iterator_pair] > found_traffic &&
+			capacity_index_fits(workspace->index, physical_position - 1, datacenter->V[virtual]))
+		{
+			found_traffic = T->value[iterator_pair];
+			found = physical_position - 1;
+		}
+	}
+	for (iterator_pair = T->column_start[virtual]; iterator_pair < T->column_start[virtual + 1]; iterator_pair++)
+	{
+		physical_position = genes[T->row[iterator_pair]];
+		if (physical_position != 0 && T->column_value[iterator_pair] > found_traffic &&
+			capacity_index_fits(workspace->index, physical_position - 1, datacenter->V[virtual]))
+		{
+			found_traffic = T->column_value[iterator_pair];
+			found = physical_position - 1;
+		}
+	}
+	return found;
+}
+
+/* most_efficient_fit: finds the physical machine for the power aware consolidation: the best fit among the physical
+ * machines already in use, otherwise the most power efficient one the virtual machine fits in, which is put in use
+ * parameter: datacenter instance
+ * parameter: workspace, attached to the individual
+ * parameter: number of physical machines in use, the first ones of the efficiency order, to update
+ * parameter: identificator of the virtual machine
+ * returns: the physical machine, -1 if there is none
+ */
+static int most_efficient_fit(struct datacenter *datacenter, struct construction_workspace *workspace, int *in_use, int virtual)
+{
+	/* iterator */
+	int iterator_position;
+	int physical;
+	int found = -1;
+	float slack;
+	float found_slack = 0.0f;
+	for (iterator_position = 0; iterator_position < *in_use; iterator_position++)
+	{
+		physical = workspace->physical_order[iterator_position];
+		if (capacity_index_fits(workspace->index, physical, datacenter->V[virtual]))
+		{
+			slack = capacity_index_slack(workspace->index, physical);
+			if (found < 0 || slack < found_slack)
+			{
+				found = physical;
+				found_slack = slack;
 			}
 		}
 	}
-	return population;
+	if (found >= 0)
+	{
+		return found;
+	}
+	for (iterator_position = *in_use; iterator_position < datacenter->h_size; iterator_position++)
+	{
+		physical = workspace->physical_order[iterator_position];
+		if (capacity_index_fits(workspace->index, physical, datacenter->V[virtual]))
+		{
+			/* the physical machine goes next to the ones in use */
+			workspace->physical_order[iterator_position] = workspace->physical_order[*in_use];
+			workspace->physical_order[(*in_use)++] = physical;
+			return physical;
+		}
+	}
+	return -1;
+}
+
+/* link_aware_fit: places a virtual machine in the first physical machine, from a random one, it fits in without
+ * overloading the network links any further
+ * parameter: datacenter instance
+ * parameter: workspace, attached to the individual
+ * parameter: random number stream of the individual
+ * parameter: identificator of the virtual machine
+ * returns: 1 if the virtual machine was placed, 0 otherwise
+ */
+static int link_aware_fit(struct datacenter *datacenter, struct construction_workspace *workspace, struct random *random, int virtual)
+{
+	/* iterator */
+	int iterator_physical;
+	int physical;
+	int start = random_int(random, datacenter->h_size);
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		physical = (start + iterator_physical) % datacenter->h_size;
+		if (capacity_index_fits(workspace->index, physical, datacenter->V[virtual]) && place_virtual(workspace, virtual, physical, 0))
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* construct_individual: builds an individual with a randomized constructive heuristic. The virtual machines are placed
+ * by decreasing noisy size, the mandatory ones first, in the physical machine chosen by the heuristic or, if it overloads
+ * a network link, next to their heaviest placed peer or in the first one that overloads none; the ones that fit nowhere
+ * are not placed, or placed anyway if they are mandatory, for the repair
+ * parameter: population arena
+ * parameter: datacenter instance
+ * parameter: workspace of the thread
+ * parameter: random number stream of the individual
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: CONSTRUCT_FIRST_FIT, CONSTRUCT_BEST_FIT, CONSTRUCT_POWER or CONSTRUCT_TRAFFIC
+ * parameter: identificator of the individual
+ * returns: nothing, it's void
+ */
+static void construct_individual(struct population *population, struct datacenter *datacenter, struct construction_workspace *workspace,
+	struct random *random, int max_SLA, int heuristic, int individual)
+{
+	int *utilization = UTILIZATION(population, individual);
+	int **H = datacenter->H;
+	int **V = datacenter->V;
+	/* iterators */
+	int iterator_virtual;
+	int iterator_physical;
+	int virtual;
+	int physical;
+	int physical_again;
+	int placed;
+	int in_use = 0;
+	memset(GENES(population, individual), 0, datacenter->v_size * sizeof (int));
+	memset(utilization, 0, datacenter->h_size * NUMBER_OF_RESOURCES * sizeof (int));
+	memset(NETWORK_UTILIZATION(population, individual), 0, datacenter->l_size * sizeof (long long));
+	evaluation_attach(workspace->evaluation, population, individual);
+	capacity_index_attach(workspace->index, utilization);
+	/* the mandatory virtual machines first, the biggest first */
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		workspace->order[iterator_virtual] = iterator_virtual;
+		workspace->size[iterator_virtual] = capacity_index_size(workspace->index, V[iterator_virtual]) *
+			(1.0f + CONSTRUCTION_NOISE * random_double(random)) + (V[iterator_virtual][3] == max_SLA ? NUMBER_OF_RESOURCES * 2 : 0);
+	}
+	sort_decreasing(workspace->order, workspace->size, datacenter->v_size);
+	/* the physical machines by increasing power per unit of Processor at full load */
+	if (heuristic == CONSTRUCT_POWER)
+	{
+		for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+		{
+			workspace->physical_order[iterator_physical] = iterator_physical;
+			workspace->consumption[iterator_physical] = -(float) ((datacenter->power_idle[iterator_physical] +
+				datacenter->power_dynamic[iterator_physical]) / (H[iterator_physical][0] > 0 ? H[iterator_physical][0] : 1) *
+				(1.0 + CONSTRUCTION_NOISE * random_double(random)));
+		}
+		sort_decreasing(workspace->physical_order, workspace->consumption, datacenter->h_size);
+	}
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		virtual = workspace->order[iterator_virtual];
+		switch (heuristic)
+		{
+			case CONSTRUCT_FIRST_FIT:
+				physical = capacity_index_find(workspace->index, V[virtual], FIT_FIRST, random_int(random, datacenter->h_size));
+				break;
+			case CONSTRUCT_BEST_FIT:
+				physical = capacity_index_find(workspace->index, V[virtual], FIT_BEST, 0);
+				break;
+			case CONSTRUCT_POWER:
+				physical = most_efficient_fit(datacenter, workspace, &in_use, virtual);
+				break;
+			default:
+				/* next to the placed peer it exchanges the most traffic with */
+				physical = heaviest_placed_peer(datacenter, workspace, virtual);
+				if (physical < 0)
+				{
+					physical = capacity_index_find(workspace->index, V[virtual], FIT_BEST, 0);
+				}
+		}
+		placed = physical >= 0 && place_virtual(workspace, virtual, physical, 0);
+		/* next to the heaviest placed peer, the traffic with it does not use the network */
+		if (!placed)
+		{
+			physical_again = heaviest_placed_peer(datacenter, workspace, virtual);
+			placed = (physical_again >= 0 && physical_again != physical && place_virtual(workspace, virtual, physical_again, 0)) ||
+				link_aware_fit(datacenter, workspace, random, virtual);
+		}
+		if (!placed && V[virtual][3] == max_SLA)
+		{
+			if (physical < 0)
+			{
+				physical = generate_solution_position(random, datacenter->h_size, 1) - 1;
+			}
+			place_virtual(workspace, virtual, physical, 1);
+		}
+	}
+}
+
+/* construction_task: builds a range of individuals, each one from its own random stream, the heuristics take turns
+ * parameter: construction context
+ * parameter: first individual
+ * parameter: end of the range of individuals
+ * parameter: thread running the task, it selects the workspace
+ * returns: nothing, it's void
+ */
+static void construction_task(void *context, int begin, int end, int thread)
+{
+	struct construction_context *construction = (struct construction_context *) context;
+	/* iterator */
+	int iterator_individual;
+	/* random stream of the current individual */
+	struct random random;
+	for (iterator_individual = begin; iterator_individual < end; iterator_individual++)
+	{
+		random_seed(&random, construction->seed, iterator_individual);
+		construct_individual(construction->population, construction->datacenter, construction->workspaces + thread, &random,
+			construction->max_SLA, iterator_individual % NUMBER_OF_CONSTRUCTIONS, construction->first_individual + iterator_individual);
+	}
+}
+
+/* initialization_constructive: builds the first individuals of a population with randomized constructive heuristics:
+ * first fit decreasing, best fit decreasing, power aware consolidation and traffic aware packing, taking turns
+ * parameter: population arena, initialized
+ * parameter: datacenter instance
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: first individual to build, the ones before it are kept
+ * parameter: number of individuals to build
+ * parameter: seed of the random streams of the individuals
+ * parameter: task pool building the individuals in parallel, NULL to build them on the calling thread
+ * parameter: scratch arena for the workspaces, NULL to allocate them for this call
+ * returns: nothing, it's void
+ */
+void initialization_constructive(struct population *population, struct datacenter *datacenter, int max_SLA, int first_individual,
+	int number_of_individuals, unsigned long long seed, struct pool *pool, struct scratch *scratch)
+{
+	/* iterator */
+	int iterator_thread;
+	struct construction_context context = {population, datacenter, max_SLA, first_individual, seed, NULL};
+	struct scratch *temporary = NULL;
+	size_t mark;
+	if (number_of_individuals > population->number_of_individuals - first_individual)
+	{
+		number_of_individuals = population->number_of_individuals - first_individual;
+	}
+	if (number_of_individuals <= 0)
+	{
+		return;
+	}
+	if (scratch == NULL)
+	{
+		scratch = temporary = scratch_create(0);
+	}
+	mark = scratch_mark(scratch);
+	context.workspaces = (struct construction_workspace *) scratch_alloc (scratch, pool_size(pool) * sizeof (struct construction_workspace));
+	for (iterator_thread = 0; iterator_thread < pool_size(pool); iterator_thread++)
+	{
+		context.workspaces[iterator_thread].index = capacity_index_create_scratch(datacenter, scratch);
+		context.workspaces[iterator_thread].evaluation = evaluation_create_scratch(datacenter, scratch);
+		context.workspaces[iterator_thread].order = (int *) scratch_alloc (scratch, (datacenter->v_size + 1) * sizeof (int));
+		context.workspaces[iterator_thread].size = (float *) scratch_alloc (scratch, (datacenter->v_size + 1) * sizeof (float));
+		context.workspaces[iterator_thread].physical_order = (int *) scratch_alloc (scratch, (datacenter->h_size + 1) * sizeof (int));
+		context.workspaces[iterator_thread].consumption = (float *) scratch_alloc (scratch, (datacenter->h_size + 1) * sizeof (float));
+	}
+	pool_run(pool, number_of_individuals, 1, construction_task, &context);
+	scratch_release(scratch, mark);
+	scratch_free(temporary);
 }
 
 /* generate_solution_position: generates a host number between 0 or 1 and parameter max_posible
+ * parameter: random number stream
  * parameter: maximun number for the randon number to return
  * parameter: SLA of the individual. for 1 the placement is mandatorly
  * returns: random number between 0 and parameter max_posible
  */
-int generate_solution_position(int max_posible, int SLA)
+int generate_solution_position(struct random *random, int max_posible, int SLA)
 {
 	/* assign to each virtual machine a random generated physical machine from 0 to the maximum possible */
 	if (SLA == 0)
 	{
 		/* integer from 0 to max_posible + 1*/
-		return rand() % (max_posible + 1);
+		return random_int(random, max_posible + 1);
 	} 
 	/* assign to each virtual machine a random generated physical machine from 1 to the maximum possible */
 	if (SLA == 1)
 	{
 		/* integer from 1 to max_posible */
-		return rand() % max_posible + 1;
+		return random_int(random, max_posible) + 1;
 	} 
 }
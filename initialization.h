@@ -11,7 +11,25 @@
 #include <stdlib.h>
 #include <math.h>
 #include <time.h>
+/* include population arena header */
+#include "population.h"
+#include "datacenter.h"
+#include "random.h"
+#include "pool.h"
+#include "scratch.h"
+#include "capacity.h"
+#include "evaluation.h"
+/* definitions, the constructive heuristics taking turns on the constructed individuals */
+#define CONSTRUCT_FIRST_FIT 0
+#define CONSTRUCT_BEST_FIT 1
+#define CONSTRUCT_POWER 2
+#define CONSTRUCT_TRAFFIC 3
+#define NUMBER_OF_CONSTRUCTIONS 4
+/* relative noise of the sizes and power efficiencies, so the constructed individuals differ */
+#define CONSTRUCTION_NOISE 0.3
 
 /* function headers definitions */
-int** initialization(int number_of_individuals, int h_size, int v_size, int **V, int max_SLA);
-int generate_solution_position(int max_posible, int SLA);
+void initialization(struct population *population, int **V, int max_SLA, unsigned long long seed, struct pool *pool);
+void initialization_constructive(struct population *population, struct datacenter *datacenter, int max_SLA, int first_individual,
+	int number_of_individuals, unsigned long long seed, struct pool *pool, struct scratch *scratch);
+int generate_solution_position(struct random *random, int max_posible, int SLA);
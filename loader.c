@@ -0,0 +1,571 @@
+/*
+ * loader.c: Virtual Machine Placement Problem - Datacenter Instance Loader
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include datacenter instance loader header */
+#include "loader.h"
+#include "common.h"
+#include "network.h"
+#include "vmpb.h"
+/* include system libraries for the memory mapping */
+#include <stdarg.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* headers of the sections, indexed by section */
+static const char *section_headers[NUMBER_OF_SECTIONS] =
+{
+	"PHYSICAL MACHINES",
+	"VIRTUAL MACHINES",
+	"NETWORK TRAFFIC",
+	"NETWORK TOPOLOGY",
+	"NETWORK LINK CAPACITY"
+};
+
+/* state of the loading of a mapped datacenter infrastructure file */
+struct loader
+{
+	const char *path;
+	const char *begin;
+	const char *end;
+	/* header line and rows [begin, end) of each section */
+	const char *header[NUMBER_OF_SECTIONS];
+	const char *section_begin[NUMBER_OF_SECTIONS];
+	const char *section_end[NUMBER_OF_SECTIONS];
+	/* next row to read of the actual section */
+	const char *cursor;
+};
+
+/* loader_error: prints an error at a position of the file, as path:line:column
+ * parameter: loader
+ * parameter: position of the error
+ * parameter: printf format of the message, and its arguments
+ * returns: -1, to return it straight away
+ */
+static int loader_error(struct loader *loader, const char *position, const char *format, ...)
+{
+	va_list arguments;
+	const char *iterator_character;
+	const char *line_begin = loader->begin;
+	int line = 1;
+	/* the line is only counted when something goes wrong */
+	for (iterator_character = loader->begin; iterator_character < position; iterator_character++)
+	{
+		if (*iterator_character == '\n')
+		{
+			line++;
+			line_begin = iterator_character + 1;
+		}
+	}
+	printf("[ERROR] %s:%d:%d: ", loader->path, line, (int) (position - line_begin) + 1);
+	va_start(arguments, format);
+	vprintf(format, arguments);
+	va_end(arguments);
+	printf("\n");
+	return -1;
+}
+
+/* is_blank: checks if a character separates values in a line
+ * parameter: character
+ * returns: 1 for spaces, tabs and carriage returns, 0 otherwise
+ */
+static int is_blank(char character)
+{
+	return character == ' ' || character == '\t' || character == '\r';
+}
+
+/* line_end: end of the line of a position
+ * parameter: loader
+ * parameter: position
+ * returns: position of the next new line, or the end of the file
+ */
+static const char * line_end(struct loader *loader, const char *position)
+{
+	const char *new_line = (const char *) memchr(position, '\n', loader->end - position);
+	return new_line != NULL ? new_line : loader->end;
+}
+
+/* find_sections: locates the header of every section in a single scan of the file
+ * parameter: loader
+ * returns: 0 if every section is present once, -1 otherwise
+ */
+static int find_sections(struct loader *loader)
+{
+	/* iterator */
+	int iterator_section;
+	int actual_section = -1;
+	const char *line;
+	const char *end;
+	const char *text;
+	const char *text_end;
+	for (line = loader->begin; line < loader->end; line = end + 1)
+	{
+		end = line_end(loader, line);
+		for (text = line; text < end && is_blank(*text); text++);
+		/* rows start with a value, headers with a letter */
+		if (text == end || !((*text >= 'A' && *text <= 'Z') || (*text >= 'a' && *text <= 'z')))
+		{
+			continue;
+		}
+		for (text_end = end; text_end > text && is_blank(text_end[-1]); text_end--);
+		for (iterator_section = 0; iterator_section < NUMBER_OF_SECTIONS; iterator_section++)
+		{
+			if ((size_t) (text_end - text) == strlen(section_headers[iterator_section]) &&
+				memcmp(text, section_headers[iterator_section], text_end - text) == 0)
+			{
+				break;
+			}
+		}
+		if (iterator_section == NUMBER_OF_SECTIONS)
+		{
+			return loader_error(loader, text, "unknown section header \"%.*s\"", (int) (text_end - text), text);
+		}
+		if (loader->header[iterator_section] != NULL)
+		{
+			return loader_error(loader, text, "duplicated section %s", section_headers[iterator_section]);
+		}
+		if (actual_section >= 0)
+		{
+			loader->section_end[actual_section] = line;
+		}
+		actual_section = iterator_section;
+		loader->header[actual_section] = text;
+		loader->section_begin[actual_section] = end < loader->end ? end + 1 : end;
+	}
+	if (actual_section >= 0)
+	{
+		loader->section_end[actual_section] = loader->end;
+	}
+	for (iterator_section = 0; iterator_section < NUMBER_OF_SECTIONS; iterator_section++)
+	{
+		if (loader->header[iterator_section] == NULL)
+		{
+			return loader_error(loader, loader->end, "missing section %s", section_headers[iterator_section]);
+		}
+	}
+	return 0;
+}
+
+/* parse_integer: parses an integer value
+ * parameter: loader
+ * parameter: position of the value, updated to the end of it
+ * parameter: parsed value to fill
+ * returns: 0 if there is a whole integer at the position, -1 otherwise
+ */
+static int parse_integer(struct loader *loader, const char **position, int *value)
+{
+	const char *character = *position;
+	long long parsed = 0;
+	int negative = 0;
+	if (character < loader->end && *character == '-')
+	{
+		negative = 1;
+		character++;
+	}
+	if (character == loader->end || *character < '0' || *character > '9')
+	{
+		return loader_error(loader, *position, "expected an integer");
+	}
+	for (; character < loader->end && *character >= '0' && *character <= '9'; character++)
+	{
+		parsed = parsed * 10 + (*character - '0');
+		if (parsed > INT_MAX)
+		{
+			return loader_error(loader, *position, "integer out of range");
+		}
+	}
+	if (character < loader->end && !is_blank(*character) && *character != '\n')
+	{
+		return loader_error(loader, character, "unexpected character '%c'", *character);
+	}
+	*value = negative ? (int) -parsed : (int) parsed;
+	*position = character;
+	return 0;
+}
+
+/* read_row: reads the next row of the actual section, skipping blank lines
+ * parameter: loader
+ * parameter: section
+ * parameter: row to fill
+ * parameter: number of values of the row
+ * returns: 1 if a row was read, 0 at the end of the section, -1 if the row is not valid
+ */
+static int read_row(struct loader *loader, int section, int *row, int number_of_columns)
+{
+	/* iterator */
+	int iterator_column;
+	const char *end;
+	const char *character;
+	while (loader->cursor < loader->section_end[section])
+	{
+		end = line_end(loader, loader->cursor);
+		for (character = loader->cursor; character < end && is_blank(*character); character++);
+		if (character == end)
+		{
+			loader->cursor = end + 1;
+			continue;
+		}
+		for (iterator_column = 0; iterator_column < number_of_columns; iterator_column++)
+		{
+			for (; character < end && is_blank(*character); character++);
+			if (character == end)
+			{
+				return loader_error(loader, character, "%s: expected %d values, found %d",
+					section_headers[section], number_of_columns, iterator_column);
+			}
+			if (parse_integer(loader, &character, &row[iterator_column]) != 0)
+			{
+				return -1;
+			}
+		}
+		for (; character < end && is_blank(*character); character++);
+		if (character != end)
+		{
+			return loader_error(loader, character, "%s: expected %d values, found more", section_headers[section], number_of_columns);
+		}
+		loader->cursor = end + 1;
+		return 1;
+	}
+	return 0;
+}
+
+/* read_table: reads every row of a section with a fixed number of values
+ * parameter: loader
+ * parameter: section
+ * parameter: number of values of each row
+ * parameter: number of rows to fill
+ * returns: the values, row after row, NULL if a row is not valid
+ */
+static int * read_table(struct loader *loader, int section, int number_of_columns, int *number_of_rows)
+{
+	int size = 16;
+	int state;
+	int *table = (int *) malloc (size * number_of_columns * sizeof (int));
+	*number_of_rows = 0;
+	loader->cursor = loader->section_begin[section];
+	for (;;)
+	{
+		if (*number_of_rows == size)
+		{
+			size *= 2;
+			table = (int *) realloc (table, size * number_of_columns * sizeof (int));
+		}
+		state = read_row(loader, section, table + *number_of_rows * number_of_columns, number_of_columns);
+		if (state < 0)
+		{
+			free(table);
+			return NULL;
+		}
+		if (state == 0)
+		{
+			return table;
+		}
+		(*number_of_rows)++;
+	}
+}
+
+/* table_rows: turns a table into the matrix layout of H and V, the rows point inside the table
+ * parameter: table
+ * parameter: number of rows
+ * parameter: number of values of each row
+ * returns: matrix
+ */
+static int ** table_rows(int *table, int number_of_rows, int number_of_columns)
+{
+	/* iterator */
+	int iterator_row;
+	int **matrix = (int **) malloc ((number_of_rows + 1) * sizeof (int *));
+	for (iterator_row = 0; iterator_row < number_of_rows; iterator_row++)
+	{
+		matrix[iterator_row] = table + iterator_row * number_of_columns;
+	}
+	return matrix;
+}
+
+/* read_traffic: reads the network traffic section into the sparse traffic matrix
+ * parameter: loader
+ * parameter: number of virtual machines
+ * returns: traffic matrix, NULL if the section is not valid
+ */
+static struct traffic_matrix * read_traffic(struct loader *loader, int v_size)
+{
+	/* iterators */
+	int iterator_row;
+	int iterator_column;
+	int state;
+	int *row = (int *) malloc ((v_size + 1) * sizeof (int));
+	/* non-zero values of T out of the diagonal, as (row, column, value) entries */
+	int number_of_entries = 0;
+	int entries_size = v_size + 1;
+	int *rows = (int *) malloc (entries_size * sizeof (int));
+	int *columns = (int *) malloc (entries_size * sizeof (int));
+	int *values = (int *) malloc (entries_size * sizeof (int));
+	struct traffic_matrix *T = NULL;
+	loader->cursor = loader->section_begin[SECTION_TRAFFIC];
+	for (iterator_row = 0; (state = read_row(loader, SECTION_TRAFFIC, row, v_size)) == 1; iterator_row++)
+	{
+		if (iterator_row == v_size)
+		{
+			loader_error(loader, loader->cursor - 1, "%s: more than %d rows", section_headers[SECTION_TRAFFIC], v_size);
+			state = -1;
+			break;
+		}
+		for (iterator_column = 0; iterator_column < v_size; iterator_column++)
+		{
+			if (row[iterator_column] < 0)
+			{
+				loader_error(loader, loader->cursor - 1, "%s: negative traffic %d between virtual machines %d and %d",
+					section_headers[SECTION_TRAFFIC], row[iterator_column], iterator_row, iterator_column);
+				state = -1;
+				break;
+			}
+			if (row[iterator_column] != 0 && iterator_column != iterator_row)
+			{
+				if (number_of_entries == entries_size)
+				{
+					entries_size *= 2;
+					rows = (int *) realloc (rows, entries_size * sizeof (int));
+					columns = (int *) realloc (columns, entries_size * sizeof (int));
+					values = (int *) realloc (values, entries_size * sizeof (int));
+				}
+				rows[number_of_entries] = iterator_row;
+				columns[number_of_entries] = iterator_column;
+				values[number_of_entries] = row[iterator_column];
+				number_of_entries++;
+			}
+		}
+		if (state == -1)
+		{
+			break;
+		}
+	}
+	if (state == 0 && iterator_row != v_size)
+	{
+		loader_error(loader, loader->section_end[SECTION_TRAFFIC], "%s: %d rows, expected %d",
+			section_headers[SECTION_TRAFFIC], iterator_row, v_size);
+		state = -1;
+	}
+	if (state == 0)
+	{
+		T = traffic_matrix_build(v_size, number_of_entries, rows, columns, values);
+		if (T == NULL)
+		{
+			loader_error(loader, loader->section_begin[SECTION_TRAFFIC], "%s: traffic of a pair of virtual machines over %d",
+				section_headers[SECTION_TRAFFIC], MAX_TRAFFIC);
+		}
+	}
+	free(row);
+	free(rows);
+	free(columns);
+	free(values);
+	return T;
+}
+
+/* read_topology: reads the network topology section into the links used by each physical machine
+ * parameter: loader
+ * parameter: number of physical machines
+ * parameter: number of network links to fill
+ * returns: network topology, NULL if the section is not valid
+ */
+static struct network_topology * read_topology(struct loader *loader, int h_size, int *l_size)
+{
+	/* iterators */
+	int iterator_physical;
+	int state;
+	int *row = (int *) malloc ((h_size + 1) * sizeof (int));
+	/* non-zero values of G, as (link, physical) entries sorted by link */
+	int number_of_entries = 0;
+	int entries_size = h_size + 1;
+	int *links = (int *) malloc (entries_size * sizeof (int));
+	int *physicals = (int *) malloc (entries_size * sizeof (int));
+	struct network_topology *topology = NULL;
+	*l_size = 0;
+	loader->cursor = loader->section_begin[SECTION_TOPOLOGY];
+	while ((state = read_row(loader, SECTION_TOPOLOGY, row, h_size)) == 1)
+	{
+		for (iterator_physical = 0; iterator_physical < h_size; iterator_physical++)
+		{
+			if (row[iterator_physical] != 0)
+			{
+				if (number_of_entries == entries_size)
+				{
+					entries_size *= 2;
+					links = (int *) realloc (links, entries_size * sizeof (int));
+					physicals = (int *) realloc (physicals, entries_size * sizeof (int));
+				}
+				links[number_of_entries] = *l_size;
+				physicals[number_of_entries] = iterator_physical;
+				number_of_entries++;
+			}
+		}
+		(*l_size)++;
+	}
+	if (state == 0)
+	{
+		topology = network_topology_build(h_size, *l_size, number_of_entries, links, physicals);
+	}
+	free(row);
+	free(links);
+	free(physicals);
+	return topology;
+}
+
+/* datacenter_derive: fills the tables derived from H and V, with the same arithmetic as the objective functions
+ * parameter: datacenter instance, with H and V loaded
+ * returns: nothing, it's void
+ */
+void datacenter_derive(struct datacenter *datacenter)
+{
+	/* iterators */
+	int iterator_virtual;
+	int iterator_physical;
+	datacenter->qos = (float *) malloc ((datacenter->v_size + 1) * sizeof (float));
+	datacenter->power_idle = (double *) malloc ((datacenter->h_size + 1) * sizeof (double));
+	datacenter->power_dynamic = (double *) malloc ((datacenter->h_size + 1) * sizeof (double));
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		datacenter->qos[iterator_virtual] = (float) pow (CONSTANT, datacenter->V[iterator_virtual][3]) * datacenter->V[iterator_virtual][3];
+	}
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		datacenter->power_idle[iterator_physical] = (double) datacenter->H[iterator_physical][3] * 0.6;
+		datacenter->power_dynamic[iterator_physical] = (double) datacenter->H[iterator_physical][3] - ((double) datacenter->H[iterator_physical][3] * 0.01);
+	}
+}
+
+/* load_datacenter: loads a datacenter infrastructure file in a single pass over a memory mapping of it.
+ * The headers of the sections are located first, then each section is parsed straight into its structure.
+ * A binary instance file is mapped and used in place instead, see vmpb.c
+ * parameter: path to the datacenter file
+ * parameter: datacenter instance to fill
+ * returns: 0 if the file is valid, -1 after printing the line and column of the first error otherwise
+ */
+int load_datacenter(const char *path_to_file, struct datacenter *datacenter)
+{
+	struct loader loader;
+	struct stat status;
+	void *mapping;
+	int datacenter_file;
+	int number_of_rows;
+	int *H_table = NULL;
+	int *V_table = NULL;
+	int result = -1;
+	memset(&loader, 0, sizeof (struct loader));
+	memset(datacenter, 0, sizeof (struct datacenter));
+	loader.path = path_to_file;
+	datacenter_file = open(path_to_file, O_RDONLY);
+	if (datacenter_file < 0 || fstat(datacenter_file, &status) != 0 || status.st_size == 0)
+	{
+		printf("[ERROR] can not read the datacenter file %s\n", path_to_file);
+		if (datacenter_file >= 0)
+		{
+			close(datacenter_file);
+		}
+		return -1;
+	}
+	mapping = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, datacenter_file, 0);
+	close(datacenter_file);
+	if (mapping == MAP_FAILED)
+	{
+		printf("[ERROR] can not map the datacenter file %s\n", path_to_file);
+		return -1;
+	}
+	/* binary instances are used in place, the tables point into the mapping */
+	if (vmpb_is_binary(mapping, status.st_size))
+	{
+		return vmpb_attach(path_to_file, mapping, status.st_size, datacenter);
+	}
+	madvise(mapping, status.st_size, MADV_SEQUENTIAL);
+	loader.begin = (const char *) mapping;
+	loader.end = loader.begin + status.st_size;
+	if (find_sections(&loader) != 0)
+	{
+		munmap(mapping, status.st_size);
+		return -1;
+	}
+	/* physical machines: Processor, Memory, Storage and Power Consumption */
+	H_table = read_table(&loader, SECTION_PHYSICAL, 4, &datacenter->h_size);
+	if (H_table != NULL && datacenter->h_size == 0)
+	{
+		loader_error(&loader, loader.header[SECTION_PHYSICAL], "no physical machines");
+	}
+	/* virtual machines: Processor, Memory, Storage, SLA and Economical Revenue */
+	else if (H_table != NULL && (V_table = read_table(&loader, SECTION_VIRTUAL, 5, &datacenter->v_size)) != NULL &&
+		(datacenter->T = read_traffic(&loader, datacenter->v_size)) != NULL &&
+		(datacenter->topology = read_topology(&loader, datacenter->h_size, &datacenter->l_size)) != NULL)
+	{
+		/* network link capacity: one per link of the topology */
+		datacenter->K = read_table(&loader, SECTION_CAPACITY, 1, &number_of_rows);
+		if (datacenter->K != NULL && number_of_rows != datacenter->l_size)
+		{
+			loader_error(&loader, loader.header[SECTION_CAPACITY], "%d network link capacities, the topology has %d network links",
+				number_of_rows, datacenter->l_size);
+		}
+		else if (datacenter->K != NULL)
+		{
+			result = 0;
+		}
+	}
+	munmap(mapping, status.st_size);
+	if (result == 0)
+	{
+		datacenter->H = table_rows(H_table, datacenter->h_size, 4);
+		datacenter->V = table_rows(V_table, datacenter->v_size, 5);
+		datacenter_derive(datacenter);
+		return 0;
+	}
+	free(H_table);
+	free(V_table);
+	free(datacenter->K);
+	if (datacenter->T != NULL)
+	{
+		traffic_matrix_free(datacenter->T);
+	}
+	if (datacenter->topology != NULL)
+	{
+		network_topology_free(datacenter->topology);
+	}
+	memset(datacenter, 0, sizeof (struct datacenter));
+	return -1;
+}
+
+/* datacenter_free: releases a datacenter instance filled by load_datacenter
+ * parameter: datacenter instance
+ * returns: nothing, it's void
+ */
+void datacenter_free(struct datacenter *datacenter)
+{
+	if (datacenter->mapping != NULL)
+	{
+		vmpb_detach(datacenter);
+		return;
+	}
+	if (datacenter->H != NULL)
+	{
+		free(datacenter->H[0]);
+		free(datacenter->H);
+	}
+	if (datacenter->V != NULL)
+	{
+		free(datacenter->V[0]);
+		free(datacenter->V);
+	}
+	if (datacenter->T != NULL)
+	{
+		traffic_matrix_free(datacenter->T);
+	}
+	if (datacenter->topology != NULL)
+	{
+		network_topology_free(datacenter->topology);
+	}
+	free(datacenter->K);
+	free(datacenter->qos);
+	free(datacenter->power_idle);
+	free(datacenter->power_dynamic);
+	memset(datacenter, 0, sizeof (struct datacenter));
+}
@@ -0,0 +1,31 @@
+/*
+ * loader.h: Virtual Machine Placement Problem - Datacenter Instance Loader Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef LOADER_H
+#define LOADER_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "datacenter.h"
+/* definitions, the sections of a datacenter infrastructure file in their usual order */
+#define SECTION_PHYSICAL 0
+#define SECTION_VIRTUAL 1
+#define SECTION_TRAFFIC 2
+#define SECTION_TOPOLOGY 3
+#define SECTION_CAPACITY 4
+#define NUMBER_OF_SECTIONS 5
+
+/* function headers definitions */
+void datacenter_derive(struct datacenter *datacenter);
+int load_datacenter(const char *path_to_file, struct datacenter *datacenter);
+void datacenter_free(struct datacenter *datacenter);
+
+#endif
@@ -1,4 +1,4 @@
-/* 
+/*
  * local_search.c: Virtual Machine Placement Problem - Local Search Stage
  * Date: 17-11-2014
  * Author: Fabio Lopez Pires (flopezpires@gmail.com)
@@ -8,139 +8,430 @@
 /* include local search stage header */
 #include "local_search.h"
 
-/* local_search: local optimization of the population
- * parameter: population matrix
- * parameter: utilization matrix of the physical machines of all the individuals
- * parameter: physical machines matrix
- * parameter: virtual machines matrix
- * parameter: number of individuals
- * parameter: number of physical machines
- * parameter: number of virtual machines
- * returns: optimized population matrix
+/* workspace of the local searches of a thread */
+struct search_workspace
+{
+	struct evaluation *evaluation;
+	struct capacity_index *index;
+	/* moves of the neighbour being tried, undone in reverse order if it is rejected */
+	int *journal_virtual;
+	int *journal_position;
+	int journal_size;
+	/* objectives of the individual and weights of its scalarization */
+	float objectives[NUMBER_OF_OBJECTIVES];
+	float weights[NUMBER_OF_OBJECTIVES];
+};
+
+/* context of the local search task */
+struct search_context
+{
+	struct population *population;
+	struct datacenter *datacenter;
+	int budget;
+	unsigned long long seed;
+	/* magnitude of each objective function in the datacenter, so the weighted sum mixes them evenly */
+	float scale[NUMBER_OF_OBJECTIVES];
+	struct search_workspace *workspaces;
+};
+
+/* place: moves a virtual machine and keeps the free capacity index up to date
+ * parameter: workspace, attached to the individual
+ * parameter: identificator of the virtual machine
+ * parameter: new physical position, from 1 to h_size, or 0 to leave the virtual machine not placed
+ * returns: nothing, it's void
  */
-int** local_search(int **population, int ***utilization, int **H, int **V, int number_of_individuals, int h_size, int v_size)
+static void place(struct search_workspace *workspace, int virtual, int physical_position)
 {
-	/* iterators */
-	int iterator_individual = 0;
-	int physical_position = 0;
-	int physical_position2 = 0;
-	int iterator_position = 0;
-	int iterator_virtual = 0;
-	int iterator_virtual2 = 0;
-	int iterator_physical = 0;
-	int option = 0;
-	/* randon value */
-	float val_rand;
-	/* value to executed */
-	int option_to_execute;
-	val_rand = drand48() *1.0;
-		
-	if (val_rand > 0 && val_rand <= 0.5)
-			option_to_execute = 0;
-	else
-			option_to_execute = 3;
-	
-	while(option < 2)
-	{
-		/* if val_rand is equal to or less than 5 is executed 1 and 2, otherwise is executed 2 and 1 */
-		if (val_rand > 0 && val_rand <= 0.5)
+	int old_physical_position = workspace->evaluation->genes[virtual];
+	evaluation_move_vm(workspace->evaluation, virtual, physical_position);
+	if (old_physical_position != 0)
+	{
+		capacity_index_update(workspace->index, old_physical_position - 1);
+	}
+	if (physical_position != 0)
+	{
+		capacity_index_update(workspace->index, physical_position - 1);
+	}
+}
+
+/* shift: moves a virtual machine as part of the neighbour being tried
+ * parameter: workspace, attached to the individual
+ * parameter: identificator of the virtual machine
+ * parameter: new physical position, from 1 to h_size
+ * returns: nothing, it's void
+ */
+static void shift(struct search_workspace *workspace, int virtual, int physical_position)
+{
+	workspace->journal_virtual[workspace->journal_size] = virtual;
+	workspace->journal_position[workspace->journal_size++] = workspace->evaluation->genes[virtual];
+	place(workspace, virtual, physical_position);
+}
+
+/* undo: undoes the moves of the neighbour being tried, in reverse order
+ * parameter: workspace, attached to the individual
+ * returns: nothing, it's void
+ */
+static void undo(struct search_workspace *workspace)
+{
+	while (workspace->journal_size > 0)
+	{
+		workspace->journal_size--;
+		place(workspace, workspace->journal_virtual[workspace->journal_size], workspace->journal_position[workspace->journal_size]);
+	}
+}
+
+/* scalarize: weighted sum of the objectives of an individual, every objective turned into a minimization
+ * parameter: local search context
+ * parameter: workspace, with the weights of the individual
+ * parameter: objectives
+ * returns: the weighted sum
+ */
+static float scalarize(struct search_context *context, struct search_workspace *workspace, float *objectives)
+{
+	/* iterator */
+	int iterator_objective;
+	float sum = 0.0f;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		sum += workspace->weights[iterator_objective] * objective_sense[iterator_objective] * objectives[iterator_objective] /
+			context->scale[iterator_objective];
+	}
+	return sum;
+}
+
+/* settle: keeps the neighbour if it dominates the individual or improves its weighted sum, without overloading the
+ * network links more, otherwise undoes its moves
+ * parameter: local search context
+ * parameter: workspace, attached to the individual
+ * parameter: traffic over the link capacities before the neighbour
+ * returns: 1 if the neighbour is kept, 0 if not
+ */
+static int settle(struct search_context *context, struct search_workspace *workspace, long long link_excess)
+{
+	float objectives[NUMBER_OF_OBJECTIVES];
+	evaluation_objectives(workspace->evaluation, objectives);
+	if (workspace->evaluation->link_excess <= link_excess &&
+		(nds_dominance(objectives, workspace->objectives, objective_sense) == 1 ||
+		scalarize(context, workspace, objectives) < scalarize(context, workspace, workspace->objectives)))
+	{
+		memcpy(workspace->objectives, objectives, NUMBER_OF_OBJECTIVES * sizeof (float));
+		workspace->journal_size = 0;
+		return 1;
+	}
+	undo(workspace);
+	return 0;
+}
+
+/* reinsert: places a virtual machine that is not placed, in the best fit physical machine
+ * parameter: local search context
+ * parameter: workspace, attached to the individual
+ * parameter: random number stream
+ * parameter: moves left, to update
+ * returns: 1 if the neighbour is kept, 0 if not
+ */
+static int reinsert(struct search_context *context, struct search_workspace *workspace, struct random *random, int *budget)
+{
+	struct datacenter *datacenter = context->datacenter;
+	int *genes = workspace->evaluation->genes;
+	long long link_excess = workspace->evaluation->link_excess;
+	/* iterator */
+	int iterator_virtual;
+	int virtual;
+	int candidate;
+	int start = random_int(random, datacenter->v_size);
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		virtual = (start + iterator_virtual) % datacenter->v_size;
+		if (genes[virtual] == 0)
 		{
-			option_to_execute++;
-			option++;
-		} else if (val_rand > 0.5 && val_rand < 1.0)
+			candidate = capacity_index_find(workspace->index, datacenter->V[virtual], FIT_BEST, 0);
+			if (candidate < 0)
+			{
+				return 0;
+			}
+			shift(workspace, virtual, candidate + 1);
+			(*budget)--;
+			return settle(context, workspace, link_excess);
+		}
+	}
+	return 0;
+}
+
+/* consolidate: empties a lightly used physical machine, its virtual machines go to the best fit among the others
+ * parameter: local search context
+ * parameter: workspace, attached to the individual
+ * parameter: random number stream
+ * parameter: moves left, to update
+ * returns: 1 if the neighbour is kept, 0 if not
+ */
+static int consolidate(struct search_context *context, struct search_workspace *workspace, struct random *random, int *budget)
+{
+	struct datacenter *datacenter = context->datacenter;
+	int *genes = workspace->evaluation->genes;
+	int *utilization = workspace->evaluation->utilization;
+	long long link_excess = workspace->evaluation->link_excess;
+	/* iterators */
+	int iterator_physical;
+	int iterator_virtual;
+	int physical;
+	int candidate;
+	int source = -1;
+	int start;
+	/* the less used of two physical machines turned on */
+	start = random_int(random, datacenter->h_size);
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		physical = (start + iterator_physical) % datacenter->h_size;
+		if (utilization[physical * NUMBER_OF_RESOURCES] > 0)
 		{
-			option_to_execute--;
-			option++;
+			source = physical;
+			break;
 		}
-		/* comes of shut down physical machines to the migrate in other virtual machines */
-		if (option_to_execute == 1)
+	}
+	if (source < 0)
+	{
+		return 0;
+	}
+	physical = random_int(random, datacenter->h_size);
+	if (utilization[physical * NUMBER_OF_RESOURCES] > 0 && (long long) utilization[physical * NUMBER_OF_RESOURCES] * datacenter->H[source][0] <
+		(long long) utilization[source * NUMBER_OF_RESOURCES] * datacenter->H[physical][0])
+	{
+		source = physical;
+	}
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		if (genes[iterator_virtual] == source + 1)
 		{
-			/* iterate on individuals */
-			for (iterator_individual = 0 ; iterator_individual < number_of_individuals ; iterator_individual++)
+			candidate = capacity_index_find(workspace->index, datacenter->V[iterator_virtual], FIT_BEST, 0);
+			if (candidate == source)
 			{
-				/* iterate on virtual machines */
-				for (iterator_virtual = 0 ; iterator_virtual < v_size ; iterator_virtual++)
-				{
-					/* get the position of the physical machine */
-					physical_position = population[iterator_individual][iterator_virtual];
-					
-					if (physical_position > 0)
-					{  
-						/* iterate on virtual machines */
-						for (iterator_virtual2 = 0 ; iterator_virtual2 < v_size ; iterator_virtual2++)
-						{
-							/* get the position of the physical machine */
-							physical_position2 = population[iterator_individual][iterator_virtual2];
-							
-							if (physical_position2 > 0)
-							{
-								if (physical_position != physical_position2)
-								{
-									/* If the use of the VM not exceeds the capacity of the physical machine performs the migration */
-									if (utilization[iterator_individual][physical_position-1][0] + V[iterator_virtual2][0] < H[physical_position-1][0] 
-									    && utilization[iterator_individual][physical_position-1][1] + V[iterator_virtual2][1] < H[physical_position-1][1] 
-									    && 	utilization[iterator_individual][physical_position-1][2] + V[iterator_virtual2][2] < H[physical_position-1][2])
-									{
-										/* refresh the utilization */
-										utilization[iterator_individual][physical_position2-1][0] -= V[iterator_virtual2][0];
-										utilization[iterator_individual][physical_position2-1][1] -= V[iterator_virtual2][1];
-										utilization[iterator_individual][physical_position2-1][2] -= V[iterator_virtual2][2];
-
-										utilization[iterator_individual][physical_position-1][0] += V[iterator_virtual2][0];
-										utilization[iterator_individual][physical_position-1][1] += V[iterator_virtual2][1];
-										utilization[iterator_individual][physical_position-1][2] += V[iterator_virtual2][2];
-										/* refresh the population */
-										population[iterator_individual][iterator_virtual2] = population[iterator_individual][iterator_virtual];
-									}
-								}
-							}
-						}
-					}
-				}
+				candidate = capacity_index_find(workspace->index, datacenter->V[iterator_virtual], FIT_FIRST, source + 1);
 			}
+			if (candidate < 0 || candidate == source)
+			{
+				/* the physical machine can not be emptied */
+				undo(workspace);
+				return 0;
+			}
+			shift(workspace, iterator_virtual, candidate + 1);
+			(*budget)--;
+		}
+	}
+	return settle(context, workspace, link_excess);
+}
+
+/* swap: exchanges the physical machines of two virtual machines, the second one preferably next to the heaviest
+ * peer of the first one
+ * parameter: local search context
+ * parameter: workspace, attached to the individual
+ * parameter: random number stream
+ * parameter: moves left, to update
+ * returns: 1 if the neighbour is kept, 0 if not
+ */
+static int swap(struct search_context *context, struct search_workspace *workspace, struct random *random, int *budget)
+{
+	struct datacenter *datacenter = context->datacenter;
+	struct traffic_matrix *T = datacenter->T;
+	int *genes = workspace->evaluation->genes;
+	int *utilization = workspace->evaluation->utilization;
+	long long link_excess = workspace->evaluation->link_excess;
+	/* iterators */
+	int iterator_virtual;
+	int iterator_pair;
+	int iterator_resource;
+	int virtual = -1;
+	int virtual_again = -1;
+	int physical;
+	int physical_again;
+	int peer_position = 0;
+	traffic_t heaviest_traffic = 0;
+	int start = random_int(random, datacenter->v_size);
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size && virtual < 0; iterator_virtual++)
+	{
+		if (genes[(start + iterator_virtual) % datacenter->v_size] != 0)
+		{
+			virtual = (start + iterator_virtual) % datacenter->v_size;
 		}
-		/*  try to place the virtual machines turned off in the physical machines turned on */
-		if (option_to_execute == 2)
+	}
+	if (virtual < 0)
+	{
+		return 0;
+	}
+	physical = genes[virtual] - 1;
+	/* the physical machine of the heaviest peer in another physical machine */
+	for (iterator_pair = T->row_start[virtual]; iterator_pair < T->row_start[virtual + 1]; iterator_pair++)
+	{
+		if (genes[T->column[iterator_pair]] != 0 && genes[T->column[iterator_pair]] != physical + 1 && T->value[iterator_pair] > heaviest_traffic)
 		{
-			/* iterate on individuals */
-			for (iterator_individual = 0 ; iterator_individual < number_of_individuals ; iterator_individual++)
-			{
-				/* iterate on virtual machines */
-				for (iterator_virtual = 0 ; iterator_virtual < v_size ; iterator_virtual++)
-				{
-					/* get the position of the physical machine */
-					physical_position = population[iterator_individual][iterator_virtual];
-					
-					if (physical_position == 0)
-					{
-						/* iterate on virtual machines */
-						for (iterator_virtual2 = 0 ; iterator_virtual2 < v_size ; iterator_virtual2++)
-						{
-							/* get the position of the physical machine */
-							physical_position2 = population[iterator_individual][iterator_virtual2];
+			heaviest_traffic = T->value[iterator_pair];
+			peer_position = genes[T->column[iterator_pair]];
+		}
+	}
+	for (iterator_pair = T->column_start[virtual]; iterator_pair < T->column_start[virtual + 1]; iterator_pair++)
+	{
+		if (genes[T->row[iterator_pair]] != 0 && genes[T->row[iterator_pair]] != physical + 1 && T->column_value[iterator_pair] > heaviest_traffic)
+		{
+			heaviest_traffic = T->column_value[iterator_pair];
+			peer_position = genes[T->row[iterator_pair]];
+		}
+	}
+	/* a virtual machine of that physical machine, or of any other one if there is no such peer */
+	start = random_int(random, datacenter->v_size);
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size && virtual_again < 0; iterator_virtual++)
+	{
+		physical_again = genes[(start + iterator_virtual) % datacenter->v_size];
+		if (physical_again != 0 && physical_again != physical + 1 && (peer_position == 0 || physical_again == peer_position))
+		{
+			virtual_again = (start + iterator_virtual) % datacenter->v_size;
+		}
+	}
+	if (virtual_again < 0)
+	{
+		return 0;
+	}
+	physical_again = genes[virtual_again] - 1;
+	/* both physical machines have to hold the exchange */
+	for (iterator_resource = 0; iterator_resource < NUMBER_OF_RESOURCES; iterator_resource++)
+	{
+		if (utilization[physical * NUMBER_OF_RESOURCES + iterator_resource] - datacenter->V[virtual][iterator_resource] +
+			datacenter->V[virtual_again][iterator_resource] > datacenter->H[physical][iterator_resource] ||
+			utilization[physical_again * NUMBER_OF_RESOURCES + iterator_resource] - datacenter->V[virtual_again][iterator_resource] +
+			datacenter->V[virtual][iterator_resource] > datacenter->H[physical_again][iterator_resource])
+		{
+			return 0;
+		}
+	}
+	shift(workspace, virtual, physical_again + 1);
+	shift(workspace, virtual_again, physical + 1);
+	(*budget) -= 2;
+	return settle(context, workspace, link_excess);
+}
 
-							if (physical_position2 > 0)
-							{
-								/* If the use of the VM not exceeds the capacity of the physical machine performs the migration */
-								if (utilization[iterator_individual][physical_position2-1][0] + V[iterator_virtual][0] < H[physical_position2-1][0] 
-								    && utilization[iterator_individual][physical_position2-1][1] + V[iterator_virtual][1] < H[physical_position2-1][1] 
-								    && 	utilization[iterator_individual][physical_position2-1][2] + V[iterator_virtual][2] < H[physical_position2-1][2])
-								{
-									/* refresh the utilization */
-									utilization[iterator_individual][physical_position2-1][0] += V[iterator_virtual][0];
-									utilization[iterator_individual][physical_position2-1][1] += V[iterator_virtual][1];
-									utilization[iterator_individual][physical_position2-1][2] += V[iterator_virtual][2];
-									/* refresh the population */
-									population[iterator_individual][iterator_virtual] = population[iterator_individual][iterator_virtual2];
-									
-									iterator_virtual2 = v_size;
-								}
-							}
-						}
-					}
-				}
-			}
+/* improve_individual: first improvement local search of an individual: random neighbours of the reinsertion,
+ * consolidation and swap neighbourhoods are evaluated incrementally and the first one kept is the new individual,
+ * until the budget of moves runs out or LOCAL_SEARCH_PATIENCE neighbours in a row are rejected. A neighbour never
+ * overloads a physical machine nor the network links more than the individual does
+ * parameter: local search context
+ * parameter: workspace of the thread
+ * parameter: random number stream of the individual
+ * parameter: identificator of the individual
+ * returns: nothing, it's void
+ */
+static void improve_individual(struct search_context *context, struct search_workspace *workspace, struct random *random, int individual)
+{
+	/* iterator */
+	int iterator_objective;
+	int budget = context->budget;
+	int failures = 0;
+	int kept;
+	evaluation_attach(workspace->evaluation, context->population, individual);
+	capacity_index_attach(workspace->index, UTILIZATION(context->population, individual));
+	evaluation_objectives(workspace->evaluation, workspace->objectives);
+	/* each individual improves along its own direction, so the population keeps spread over the front */
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		workspace->weights[iterator_objective] = (float) random_double(random);
+	}
+	workspace->journal_size = 0;
+	while (budget > 0 && failures < LOCAL_SEARCH_PATIENCE)
+	{
+		switch (random_int(random, NUMBER_OF_MOVES))
+		{
+			case MOVE_REINSERT:
+				kept = reinsert(context, workspace, random, &budget);
+				break;
+			case MOVE_CONSOLIDATE:
+				kept = consolidate(context, workspace, random, &budget);
+				break;
+			default:
+				kept = swap(context, workspace, random, &budget);
+		}
+		failures = kept ? 0 : failures + 1;
+	}
+}
+
+/* local_search_task: improves a range of individuals, each one from its own random stream
+ * parameter: local search context
+ * parameter: first individual
+ * parameter: end of the range of individuals
+ * parameter: thread running the task, it selects the workspace
+ * returns: nothing, it's void
+ */
+static void local_search_task(void *context, int begin, int end, int thread)
+{
+	struct search_context *search = (struct search_context *) context;
+	/* iterator */
+	int iterator_individual;
+	/* random stream of the current individual */
+	struct random random;
+	for (iterator_individual = begin; iterator_individual < end; iterator_individual++)
+	{
+		random_seed(&random, search->seed, iterator_individual);
+		improve_individual(search, search->workspaces + thread, &random, iterator_individual);
+	}
+}
+
+/* local_search: local optimization of the population with incremental evaluation, see improve_individual
+ * parameter: population arena, with the utilization and network utilization loaded, optimized in place
+ * parameter: datacenter instance
+ * parameter: budget of virtual machine moves of each individual, 0 disables the local search
+ * parameter: seed of the random streams of the individuals
+ * parameter: task pool improving the individuals in parallel, NULL to improve them on the calling thread
+ * parameter: scratch arena for the workspaces, NULL to allocate them for this call
+ * returns: nothing, it's void
+ */
+void local_search(struct population *population, struct datacenter *datacenter, int budget, unsigned long long seed,
+	struct pool *pool, struct scratch *scratch)
+{
+	/* iterators */
+	int iterator_thread;
+	int iterator_physical;
+	int iterator_virtual;
+	int iterator_pair;
+	int iterator_objective;
+	struct search_context context = {population, datacenter, budget, seed, {0.0f, 0.0f, 0.0f, 0.0f, 1.0f}, NULL};
+	struct scratch *temporary = NULL;
+	size_t mark;
+	if (budget <= 0 || population->number_of_individuals == 0)
+	{
+		return;
+	}
+	/* the magnitudes: every physical machine at full load, all the traffic, and every virtual machine placed */
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		context.scale[0] += (float) (datacenter->power_idle[iterator_physical] + datacenter->power_dynamic[iterator_physical]);
+	}
+	for (iterator_pair = 0; iterator_pair < datacenter->T->row_start[datacenter->v_size]; iterator_pair++)
+	{
+		context.scale[1] += datacenter->T->value[iterator_pair];
+	}
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		context.scale[2] += datacenter->V[iterator_virtual][4];
+		context.scale[3] += datacenter->qos[iterator_virtual];
+	}
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		if (context.scale[iterator_objective] <= 0.0f)
+		{
+			context.scale[iterator_objective] = 1.0f;
 		}
 	}
-	return population;
+	if (scratch == NULL)
+	{
+		scratch = temporary = scratch_create(0);
+	}
+	mark = scratch_mark(scratch);
+	context.workspaces = (struct search_workspace *) scratch_alloc (scratch, pool_size(pool) * sizeof (struct search_workspace));
+	for (iterator_thread = 0; iterator_thread < pool_size(pool); iterator_thread++)
+	{
+		context.workspaces[iterator_thread].evaluation = evaluation_create_scratch(datacenter, scratch);
+		context.workspaces[iterator_thread].index = capacity_index_create_scratch(datacenter, scratch);
+		context.workspaces[iterator_thread].journal_virtual = (int *) scratch_alloc (scratch, (datacenter->v_size + 1) * sizeof (int));
+		context.workspaces[iterator_thread].journal_position = (int *) scratch_alloc (scratch, (datacenter->v_size + 1) * sizeof (int));
+	}
+	/* the cost varies a lot between individuals, single individual chunks let the threads balance it */
+	pool_run(pool, population->number_of_individuals, 1, local_search_task, &context);
+	scratch_release(scratch, mark);
+	scratch_free(temporary);
 }
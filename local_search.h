@@ -1,4 +1,4 @@
-/* 
+/*
  * local_search.h: Virtual Machine Placement Problem - Local Search Stage Header
  * Date: 17-11-2014
  * Author: Fabio Lopez Pires (flopezpires@gmail.com)
@@ -11,6 +11,23 @@
 #include <stdlib.h>
 #include <math.h>
 #include <time.h>
+/* include population arena header */
+#include "population.h"
+#include "datacenter.h"
+#include "evaluation.h"
+#include "capacity.h"
+#include "random.h"
+#include "pool.h"
+#include "scratch.h"
+#include "nds.h"
+/* definitions: the neighbourhoods of the local search */
+#define MOVE_REINSERT 0
+#define MOVE_CONSOLIDATE 1
+#define MOVE_SWAP 2
+#define NUMBER_OF_MOVES 3
+/* tries in a row without improvement that end the local search of an individual */
+#define LOCAL_SEARCH_PATIENCE 16
 
 /* function headers definitions */
-int** local_search(int **population, int ***utilization, int **H, int **V, int number_of_individuals, int h_size, int v_size);
+void local_search(struct population *population, struct datacenter *datacenter, int budget, unsigned long long seed,
+	struct pool *pool, struct scratch *scratch);
@@ -0,0 +1,471 @@
+/*
+ * nds.c: Virtual Machine Placement Problem - Non-Dominated Sorting
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include non-dominated sorting header */
+#include "nds.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* sense of each objective function: power, traffic and MLU are minimized, revenue and QoS are maximized */
+const float objective_sense[NUMBER_OF_OBJECTIVES] = {OBJECTIVE_MINIMIZE, OBJECTIVE_MINIMIZE, OBJECTIVE_MAXIMIZE, OBJECTIVE_MAXIMIZE, OBJECTIVE_MINIMIZE};
+/* sense of the minimization keys, every objective is minimized */
+static const float minimization_sense[NUMBER_OF_OBJECTIVES] = {OBJECTIVE_MINIMIZE, OBJECTIVE_MINIMIZE, OBJECTIVE_MINIMIZE, OBJECTIVE_MINIMIZE, OBJECTIVE_MINIMIZE};
+
+/* nds_dominance: branchless Pareto dominance, "all no worse and any better" in the sense of each objective
+ * parameter: objectives of the solution a
+ * parameter: objectives of the solution b
+ * parameter: sense of each objective, OBJECTIVE_MINIMIZE or OBJECTIVE_MAXIMIZE
+ * returns: 1 if a dominates b, -1 if b dominates a, 0 if both a and b are non-dominated
+ */
+int nds_dominance(const float *solution_a, const float *solution_b, const float *sense)
+{
+	/* iterator */
+	int iterator_objective = 0;
+	/* bit k is set when a is better (worse) than b in the objective k */
+	int better = 0;
+	int worse = 0;
+	float value_a;
+	float value_b;
+#ifdef __SSE2__
+	__m128 lanes_a;
+	__m128 lanes_b;
+	/* four objectives per compare, multiplying by the sense turns every objective into a minimization */
+	for (; iterator_objective + 4 <= NUMBER_OF_OBJECTIVES; iterator_objective += 4)
+	{
+		lanes_a = _mm_mul_ps(_mm_loadu_ps(solution_a + iterator_objective), _mm_loadu_ps(sense + iterator_objective));
+		lanes_b = _mm_mul_ps(_mm_loadu_ps(solution_b + iterator_objective), _mm_loadu_ps(sense + iterator_objective));
+		better |= _mm_movemask_ps(_mm_cmplt_ps(lanes_a, lanes_b)) << iterator_objective;
+		worse |= _mm_movemask_ps(_mm_cmpgt_ps(lanes_a, lanes_b)) << iterator_objective;
+	}
+#endif
+	/* remaining objectives */
+	for (; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		value_a = solution_a[iterator_objective] * sense[iterator_objective];
+		value_b = solution_b[iterator_objective] * sense[iterator_objective];
+		better |= (value_a < value_b) << iterator_objective;
+		worse |= (value_a > value_b) << iterator_objective;
+	}
+	return (worse == 0 && better != 0) - (better == 0 && worse != 0);
+}
+
+/* nds_compare: Pareto dominance between two solutions of the datacenter problem
+ * parameter: objectives of the solution a
+ * parameter: objectives of the solution b
+ * returns: 1 if a dominates b, -1 if b dominates a, 0 if both a and b are non-dominated
+ */
+int nds_compare(float *solution_a, float *solution_b)
+{
+	return nds_dominance(solution_a, solution_b, objective_sense);
+}
+
+/* minimization_keys: copies the objectives multiplied by their sense, so every objective is minimized
+ * parameter: objectives block of the solutions [individual][objective]
+ * parameter: number of individuals
+ * parameter: scratch arena holding the keys
+ * returns: keys block [individual][objective]
+ */
+static float * minimization_keys(float *objectives, int number_of_individuals, struct scratch *scratch)
+{
+	float *keys = (float *) scratch_alloc (scratch, ((size_t) number_of_individuals * NUMBER_OF_OBJECTIVES + 1) *sizeof (float));
+	/* iterators */
+	int iterator_solution;
+	int iterator_objective;
+	for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+	{
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			keys[iterator_solution * NUMBER_OF_OBJECTIVES + iterator_objective] =
+				objectives[iterator_solution * NUMBER_OF_OBJECTIVES + iterator_objective] * objective_sense[iterator_objective];
+		}
+	}
+	return keys;
+}
+
+/* fast_non_dominated_sorting: fast non-dominated sorting of Deb et al., O(M N^2)
+ * parameter: keys block of the solutions [individual][objective]
+ * parameter: number of individuals
+ * parameter: array of the Pareto front of each solution to fill, from 1
+ * parameter: scratch arena holding the temporary arrays
+ * returns: nothing, it's void
+ */
+static void fast_non_dominated_sorting(float *keys, int number_of_individuals, int *pareto_fronts, struct scratch *scratch)
+{
+	/* iterators */
+	int iterator_solution;
+	int iterator_comparision;
+	int iterator_front;
+	int entry;
+	int dominance;
+	int dominating;
+	int dominated;
+	/* number of solutions dominating each solution */
+	int *domination_count = (int *) scratch_alloc (scratch, (number_of_individuals + 1) *sizeof (int));
+	/* solutions dominated by each solution, as linked lists of entries */
+	int *first_entry = (int *) scratch_alloc (scratch, (number_of_individuals + 1) *sizeof (int));
+	int entries_size = number_of_individuals + 1;
+	int *entry_solution = (int *) scratch_alloc (scratch, entries_size *sizeof (int));
+	int *entry_next = (int *) scratch_alloc (scratch, entries_size *sizeof (int));
+	int *entries_grown;
+	int number_of_entries = 0;
+	/* solutions of the actual Pareto front, followed by the ones of the next front */
+	int *front = (int *) scratch_alloc (scratch, (number_of_individuals + 1) *sizeof (int));
+	int front_begin = 0;
+	int front_end = 0;
+	int next_end;
+	int actual_pareto_front = 1;
+
+	for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+	{
+		domination_count[iterator_solution] = 0;
+		first_entry[iterator_solution] = -1;
+	}
+	/* compare every pair of solutions once */
+	for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+	{
+		for (iterator_comparision = iterator_solution + 1; iterator_comparision < number_of_individuals; iterator_comparision++)
+		{
+			dominance = nds_dominance(keys + iterator_solution * NUMBER_OF_OBJECTIVES, keys + iterator_comparision * NUMBER_OF_OBJECTIVES,
+				minimization_sense);
+			if (dominance == 1)
+			{
+				dominating = iterator_solution;
+				dominated = iterator_comparision;
+			}
+			else if (dominance == -1)
+			{
+				dominating = iterator_comparision;
+				dominated = iterator_solution;
+			}
+			else
+			{
+				continue;
+			}
+			domination_count[dominated]++;
+			if (number_of_entries == entries_size)
+			{
+				/* the old entries stay in the scratch arena until the release of the whole sorting */
+				entries_grown = (int *) scratch_alloc (scratch, 2 * entries_size *sizeof (int));
+				memcpy(entries_grown, entry_solution, number_of_entries *sizeof (int));
+				entry_solution = entries_grown;
+				entries_grown = (int *) scratch_alloc (scratch, 2 * entries_size *sizeof (int));
+				memcpy(entries_grown, entry_next, number_of_entries *sizeof (int));
+				entry_next = entries_grown;
+				entries_size *= 2;
+			}
+			entry_solution[number_of_entries] = dominated;
+			entry_next[number_of_entries] = first_entry[dominating];
+			first_entry[dominating] = number_of_entries++;
+		}
+	}
+	/* the first Pareto front holds the solutions not dominated by any other */
+	for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+	{
+		if (domination_count[iterator_solution] == 0)
+		{
+			pareto_fronts[iterator_solution] = actual_pareto_front;
+			front[front_end++] = iterator_solution;
+		}
+	}
+	/* peel the fronts: a solution enters the next front when all its dominating solutions are assigned */
+	while (front_begin < front_end)
+	{
+		actual_pareto_front++;
+		next_end = front_end;
+		for (iterator_front = front_begin; iterator_front < front_end; iterator_front++)
+		{
+			for (entry = first_entry[front[iterator_front]]; entry != -1; entry = entry_next[entry])
+			{
+				dominated = entry_solution[entry];
+				if (--domination_count[dominated] == 0)
+				{
+					pareto_fronts[dominated] = actual_pareto_front;
+					front[next_end++] = dominated;
+				}
+			}
+		}
+		front_begin = front_end;
+		front_end = next_end;
+	}
+}
+
+/* structure of a solution while it is sorted by ens_order */
+struct ens_record
+{
+	float key[NUMBER_OF_OBJECTIVES];
+	int solution;
+};
+
+/* ens_order: lexicographic order of the minimization keys, for ens_sort
+ * parameter: first record
+ * parameter: second record
+ * returns: negative, 0 or positive as the first solution comes before, together or after the second one
+ */
+static int ens_order(const void *a, const void *b)
+{
+	const struct ens_record *record_a = (const struct ens_record *) a;
+	const struct ens_record *record_b = (const struct ens_record *) b;
+	/* iterator */
+	int iterator_objective;
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		if (record_a->key[iterator_objective] < record_b->key[iterator_objective])
+		{
+			return -1;
+		}
+		if (record_a->key[iterator_objective] > record_b->key[iterator_objective])
+		{
+			return 1;
+		}
+	}
+	/* equal solutions keep their original order */
+	return record_a->solution - record_b->solution;
+}
+
+/* ens_sort: sorts the records by ens_order, a bottom-up merge sort since qsort of glibc allocates its own buffer
+ * parameter: records
+ * parameter: number of records
+ * parameter: scratch arena holding the merge buffer
+ * returns: nothing, it's void
+ */
+static void ens_sort(struct ens_record *order, int number_of_records, struct scratch *scratch)
+{
+	/* iterators */
+	int width;
+	int begin;
+	int left;
+	int right;
+	int middle;
+	int end;
+	int iterator_merged;
+	struct ens_record *source = order;
+	struct ens_record *destination = (struct ens_record *) scratch_alloc (scratch, (number_of_records + 1) *sizeof (struct ens_record));
+	struct ens_record *swap;
+	for (width = 1; width < number_of_records; width *= 2)
+	{
+		for (begin = 0; begin < number_of_records; begin += 2 * width)
+		{
+			middle = begin + width < number_of_records ? begin + width : number_of_records;
+			end = begin + 2 * width < number_of_records ? begin + 2 * width : number_of_records;
+			left = begin;
+			right = middle;
+			for (iterator_merged = begin; iterator_merged < end; iterator_merged++)
+			{
+				if (left < middle && (right == end || ens_order(&source[left], &source[right]) <= 0))
+				{
+					destination[iterator_merged] = source[left++];
+				}
+				else
+				{
+					destination[iterator_merged] = source[right++];
+				}
+			}
+		}
+		swap = source;
+		source = destination;
+		destination = swap;
+	}
+	if (source != order)
+	{
+		memcpy(order, source, number_of_records * sizeof (struct ens_record));
+	}
+}
+
+/* efficient_non_dominated_sorting: efficient non-dominated sorting with binary search (ENS-BS) of Zhang et al.
+ * parameter: keys block of the solutions [individual][objective]
+ * parameter: number of individuals
+ * parameter: array of the Pareto front of each solution to fill, from 1
+ * parameter: scratch arena holding the temporary arrays
+ * returns: nothing, it's void
+ */
+static void efficient_non_dominated_sorting(float *keys, int number_of_individuals, int *pareto_fronts, struct scratch *scratch)
+{
+	/* iterators */
+	int iterator_order;
+	int member;
+	int solution;
+	int low;
+	int high;
+	int middle;
+	int dominated;
+	/* solutions in lexicographic order, a solution can only be dominated by the ones before it */
+	struct ens_record *order = (struct ens_record *) scratch_alloc (scratch, (number_of_individuals + 1) *sizeof (struct ens_record));
+	/* last solution added to each front, and the solution added before it to the same front */
+	int *front_last = (int *) scratch_alloc (scratch, (number_of_individuals + 1) *sizeof (int));
+	int *previous = (int *) scratch_alloc (scratch, (number_of_individuals + 1) *sizeof (int));
+	int number_of_fronts = 0;
+
+	for (iterator_order = 0; iterator_order < number_of_individuals; iterator_order++)
+	{
+		memcpy(order[iterator_order].key, keys + iterator_order * NUMBER_OF_OBJECTIVES, NUMBER_OF_OBJECTIVES * sizeof (float));
+		order[iterator_order].solution = iterator_order;
+	}
+	ens_sort(order, number_of_individuals, scratch);
+	for (iterator_order = 0; iterator_order < number_of_individuals; iterator_order++)
+	{
+		solution = order[iterator_order].solution;
+		/* binary search of the first front with no member dominating the solution */
+		low = 0;
+		high = number_of_fronts;
+		while (low < high)
+		{
+			middle = (low + high) / 2;
+			dominated = 0;
+			/* the last added members are the closest ones, so they are checked first */
+			for (member = front_last[middle]; member != -1; member = previous[member])
+			{
+				if (nds_dominance(keys + member * NUMBER_OF_OBJECTIVES, keys + solution * NUMBER_OF_OBJECTIVES, minimization_sense) == 1)
+				{
+					dominated = 1;
+					break;
+				}
+			}
+			if (dominated)
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+		if (low == number_of_fronts)
+		{
+			front_last[number_of_fronts++] = -1;
+		}
+		previous[solution] = front_last[low];
+		front_last[low] = solution;
+		pareto_fronts[solution] = low + 1;
+	}
+}
+
+/* nds_sort_scratch: calculate the Pareto front of each solution according to NSGA-II, without allocations
+ * parameter: objectives block of the solutions [individual][objective]
+ * parameter: number of individuals
+ * parameter: NDS_FAST, NDS_ENS_BS or NDS_AUTO to choose by the number of individuals
+ * parameter: array of the Pareto front of each solution to fill, from 1
+ * parameter: scratch arena for the temporary arrays, they are released before returning
+ * returns: nothing, it's void
+ */
+void nds_sort_scratch(float *objectives, int number_of_individuals, int method, int *pareto_fronts, struct scratch *scratch)
+{
+	size_t mark = scratch_mark(scratch);
+	float *keys = minimization_keys(objectives, number_of_individuals, scratch);
+	if (method == NDS_AUTO)
+	{
+		method = number_of_individuals < NDS_SMALL_POPULATION ? NDS_FAST : NDS_ENS_BS;
+	}
+	if (method == NDS_FAST)
+	{
+		fast_non_dominated_sorting(keys, number_of_individuals, pareto_fronts, scratch);
+	}
+	else
+	{
+		efficient_non_dominated_sorting(keys, number_of_individuals, pareto_fronts, scratch);
+	}
+	scratch_release(scratch, mark);
+}
+
+/* nds_sort_constrained: calculate the Pareto front of each solution with the constrained dominance of NSGA-II,
+ * without allocations: a factible solution dominates every solution that is not factible, so the factible solutions
+ * are sorted among themselves and the others are sorted among themselves in the fronts after them
+ * parameter: objectives block of the solutions [individual][objective]
+ * parameter: feasibility of each solution, 1 if it is factible
+ * parameter: number of individuals
+ * parameter: NDS_FAST, NDS_ENS_BS or NDS_AUTO to choose by the number of individuals
+ * parameter: array of the Pareto front of each solution to fill, from 1
+ * parameter: scratch arena for the temporary arrays, they are released before returning
+ * returns: nothing, it's void
+ */
+void nds_sort_constrained(float *objectives, const int *feasible, int number_of_individuals, int method, int *pareto_fronts,
+	struct scratch *scratch)
+{
+	size_t mark;
+	/* iterators */
+	int iterator_solution;
+	int iterator_group;
+	int number_of_feasible = 0;
+	int number_of_members;
+	int last_front = 0;
+	/* solutions of each group, the factible ones first, with their objectives and fronts */
+	int *members;
+	float *block;
+	int *fronts;
+	for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+	{
+		number_of_feasible += feasible[iterator_solution] != 0;
+	}
+	/* the usual case: every solution is factible, or none of them is */
+	if (number_of_feasible == number_of_individuals || number_of_feasible == 0)
+	{
+		nds_sort_scratch(objectives, number_of_individuals, method, pareto_fronts, scratch);
+		return;
+	}
+	mark = scratch_mark(scratch);
+	members = (int *) scratch_alloc (scratch, (number_of_individuals + 1) * sizeof (int));
+	block = (float *) scratch_alloc (scratch, ((size_t) number_of_individuals * NUMBER_OF_OBJECTIVES + 1) * sizeof (float));
+	fronts = (int *) scratch_alloc (scratch, (number_of_individuals + 1) * sizeof (int));
+	for (iterator_group = 0; iterator_group < 2; iterator_group++)
+	{
+		number_of_members = 0;
+		for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+		{
+			if ((feasible[iterator_solution] != 0) == (iterator_group == 0))
+			{
+				memcpy(block + number_of_members * NUMBER_OF_OBJECTIVES, objectives + iterator_solution * NUMBER_OF_OBJECTIVES,
+					NUMBER_OF_OBJECTIVES * sizeof (float));
+				members[number_of_members++] = iterator_solution;
+			}
+		}
+		nds_sort_scratch(block, number_of_members, method, fronts, scratch);
+		for (iterator_solution = 0; iterator_solution < number_of_members; iterator_solution++)
+		{
+			pareto_fronts[members[iterator_solution]] = fronts[iterator_solution] + (iterator_group == 0 ? 0 : last_front);
+			if (iterator_group == 0 && fronts[iterator_solution] > last_front)
+			{
+				last_front = fronts[iterator_solution];
+			}
+		}
+	}
+	scratch_release(scratch, mark);
+}
+
+/* nds_sort: calculate the Pareto front of each solution according to NSGA-II
+ * parameter: objectives block of the solutions [individual][objective]
+ * parameter: number of individuals
+ * parameter: NDS_FAST, NDS_ENS_BS or NDS_AUTO to choose by the number of individuals
+ * returns: array with the Pareto front of each solution, from 1
+ */
+int *nds_sort(float *objectives, int number_of_individuals, int method)
+{
+	int *pareto_fronts = (int *) malloc ((number_of_individuals + 1) *sizeof (int));
+	struct scratch *scratch = scratch_create(0);
+	nds_sort_scratch(objectives, number_of_individuals, method, pareto_fronts, scratch);
+	scratch_free(scratch);
+	return pareto_fronts;
+}
+
+/* nds_sort_rows: calculate the Pareto front of each solution of a matrix of objectives
+ * parameter: objectives matrix of the solutions [individual][objective]
+ * parameter: number of individuals
+ * parameter: NDS_FAST, NDS_ENS_BS or NDS_AUTO to choose by the number of individuals
+ * returns: array with the Pareto front of each solution, from 1
+ */
+int *nds_sort_rows(float **objectives, int number_of_individuals, int method)
+{
+	float *block = (float *) malloc (((size_t) number_of_individuals * NUMBER_OF_OBJECTIVES + 1) *sizeof (float));
+	int *pareto_fronts;
+	/* iterator */
+	int iterator_solution;
+	for (iterator_solution = 0; iterator_solution < number_of_individuals; iterator_solution++)
+	{
+		memcpy(block + iterator_solution * NUMBER_OF_OBJECTIVES, objectives[iterator_solution], NUMBER_OF_OBJECTIVES * sizeof (float));
+	}
+	pareto_fronts = nds_sort(block, number_of_individuals, method);
+	free(block);
+	return pareto_fronts;
+}
@@ -0,0 +1,41 @@
+/*
+ * nds.h: Virtual Machine Placement Problem - Non-Dominated Sorting Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef NDS_H
+#define NDS_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include population arena header */
+#include "population.h"
+#include "scratch.h"
+/* non-dominated sorting methods */
+#define NDS_AUTO 0
+#define NDS_FAST 1
+#define NDS_ENS_BS 2
+/* sense of an objective function */
+#define OBJECTIVE_MINIMIZE 1.0f
+#define OBJECTIVE_MAXIMIZE -1.0f
+/* populations smaller than this are sorted with the fast non-dominated sorting of Deb */
+#define NDS_SMALL_POPULATION 16
+
+/* sense of each objective function of the datacenter problem */
+extern const float objective_sense[NUMBER_OF_OBJECTIVES];
+
+/* function headers definitions */
+void nds_sort_scratch(float *objectives, int number_of_individuals, int method, int *pareto_fronts, struct scratch *scratch);
+void nds_sort_constrained(float *objectives, const int *feasible, int number_of_individuals, int method, int *pareto_fronts,
+	struct scratch *scratch);
+int *nds_sort(float *objectives, int number_of_individuals, int method);
+int *nds_sort_rows(float **objectives, int number_of_individuals, int method);
+int nds_dominance(const float *solution_a, const float *solution_b, const float *sense);
+int nds_compare(float *solution_a, float *solution_b);
+
+#endif
@@ -8,280 +8,429 @@
 /* include network header */
 #include "network.h"
 
-/* get_l_size: returns the number of network links
- * parameter: path to the datacenter file
- * returns: number of network links
+/* structure of a pair of virtual machines while the traffic matrix is built */
+struct traffic_pair
+{
+	int column;
+	long value;
+};
+
+/* compare_traffic_pairs: orders the pairs of a row by column, for qsort
+ * parameter: first pair
+ * parameter: second pair
+ * returns: negative, 0 or positive as the first column is smaller, equal or bigger
  */
-int get_l_size(char path_to_file[])
+static int compare_traffic_pairs(const void *a, const void *b)
 {
-	/* datacenter file to read from */
-	FILE *datacenter_file;
-	/* line readed from file */
-	char input_line[TAM_BUFFER];
-	/* number of network links */
-	int l_size = 0;
-	/* 1 if is reading the network topology block in the file */
-	int reading_links = 0;
- 	/* open the file for reading */
-	datacenter_file = fopen(path_to_file,"r");
-    /* if it is opened ok, we continue */
-	if (datacenter_file != NULL) 
-	{ 
-		/* read until the end */
-		while(!feof(datacenter_file)) 
-		{
-			/* get line per line */
-			fgets(input_line, TAM_BUFFER, datacenter_file);
-			/* if the line is equal to L_HEADER, we begin the network topology block in the file */
-			if (strstr(input_line,L_HEADER) != NULL)
-			{
-				reading_links = 1;
-			}
-			/* if the line is equal to C_HEADER, we end the network topology block in the file */
-			if (strstr(input_line,C_HEADER) != NULL)
-			{
-				reading_links = 0;
-				break;
-			}
-			/* if we are in the correct block in the file, it is not the header and it is not a blank line, we count */
-			if (reading_links == 1 && strstr(input_line,L_HEADER) == NULL && strcmp(input_line, "\n") != 0)
-			{
-				l_size++;
-			}
-		}
-	}
-	/* close the file */
-	fclose(datacenter_file);
-	/* return the value */
-	return 100;
+	return ((const struct traffic_pair *) a)->column - ((const struct traffic_pair *) b)->column;
 }
 
-/* load_T: load the values of T
+/* traffic_matrix_build: builds the sparse traffic matrix from the non-zero values of T
  * parameter: number of virtual machines
- * parameter: path to the datacenter file
- * returns: T matrix
+ * parameter: number of non-zero values
+ * parameter: row of each value
+ * parameter: column of each value
+ * parameter: traffic of each value, both T[i][j] and T[j][i] are added to the pair
+ * returns: T matrix, as a sparse upper triangle of T + T', NULL if the traffic of a pair is out of 0 to MAX_TRAFFIC
  */
-int** load_T(int v_size, char path_to_file[])
+struct traffic_matrix * traffic_matrix_build(int v_size, int number_of_entries, int *rows, int *columns, int *values)
 {
-	/* datacenter file to read from */
-	FILE *datacenter_file;
-	/* line readed from file */
-	char input_line[TAM_BUFFER];
+	struct traffic_matrix *T = (struct traffic_matrix *) malloc (sizeof (struct traffic_matrix));
 	/* iterators */
-	int iterator_row = 0;
-	int iterator_column = 0;
-	int iterator_line = 0;
-	/* 1 if is reading the network traffic block in the file */
-	int reading_traffic = 0;
-	char *ptr;
-	/* memory reserve for v_size virtual machines */
-	int **T = (int **) malloc (v_size *sizeof (int *));
- 	/* open the file for reading */
-	datacenter_file = fopen(path_to_file,"r");
-    /* if it is opened ok, we continue */    
-	if (datacenter_file != NULL) 
-	{ 
-		/* read until the end */
-		while(iterator_row < v_size)  
+	int iterator_entry;
+	int iterator_virtual;
+	int iterator_pair;
+	int row;
+	int column;
+	int row_begin;
+	int number_of_pairs = 0;
+	/* entries grouped by the smaller identificator of the pair */
+	int *row_end = (int *) calloc (v_size + 1, sizeof (int));
+	struct traffic_pair *pairs = (struct traffic_pair *) malloc ((number_of_entries + 1) *sizeof (struct traffic_pair));
+
+	T->v_size = v_size;
+	T->row_start = (int *) calloc (v_size + 1, sizeof (int));
+	T->column_start = (int *) calloc (v_size + 1, sizeof (int));
+	/* counting sort of the entries by the smaller identificator of the pair */
+	for (iterator_entry = 0; iterator_entry < number_of_entries; iterator_entry++)
+	{
+		row = rows[iterator_entry] < columns[iterator_entry] ? rows[iterator_entry] : columns[iterator_entry];
+		row_end[row + 1]++;
+	}
+	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	{
+		row_end[iterator_virtual + 1] += row_end[iterator_virtual];
+	}
+	for (iterator_entry = 0; iterator_entry < number_of_entries; iterator_entry++)
+	{
+		row = rows[iterator_entry] < columns[iterator_entry] ? rows[iterator_entry] : columns[iterator_entry];
+		column = rows[iterator_entry] < columns[iterator_entry] ? columns[iterator_entry] : rows[iterator_entry];
+		pairs[row_end[row]].column = column;
+		pairs[row_end[row]].value = values[iterator_entry];
+		row_end[row]++;
+	}
+	/* sort each row by column and merge T[i][j] with T[j][i], compacting the rows in place */
+	row_begin = 0;
+	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	{
+		T->row_start[iterator_virtual] = number_of_pairs;
+		qsort(pairs + row_begin, row_end[iterator_virtual] - row_begin, sizeof (struct traffic_pair), compare_traffic_pairs);
+		for (iterator_entry = row_begin; iterator_entry < row_end[iterator_virtual]; iterator_entry++)
 		{
-			/* get line per line */
-			fgets(input_line, TAM_BUFFER, datacenter_file);
-			iterator_line++;
-			/* reset iterator of columns */
-			iterator_column = 0;
-			/* if the line is equal to T_HEADER, we begin the network traffic block in the file */
-			if (strstr(input_line,T_HEADER) != NULL)
+			if (number_of_pairs > T->row_start[iterator_virtual] && pairs[number_of_pairs - 1].column == pairs[iterator_entry].column)
 			{
-				reading_traffic = 1;
+				pairs[number_of_pairs - 1].value += pairs[iterator_entry].value;
 			}
-			/* if it's the correct block in the file, it is not the header and it is not a blank line, we count */			
-			if (reading_traffic == 1 && strstr(input_line,T_HEADER) == NULL && strcmp(input_line, "\n") != 0)
+			else
 			{
-				/* memory reserve for v_size virtual machines */
-				T[iterator_row] = (int *) malloc (v_size *sizeof (int));
-				/* strtok first time and load the value */
-				ptr = strtok(input_line," \n\t");
-				sscanf(ptr,"%d",&T[iterator_row][iterator_column]);
-				/* load all the next tokens of the input line */
-				while( (ptr = strtok( NULL, "\t" )) != NULL )
-				{		
-					/* increment iterator of columns and load the value */
-					iterator_column++;
-					sscanf(ptr,"%d",&T[iterator_row][iterator_column]);
-				}
-				/* increment iterator of rows */
-				iterator_row++;
-			} 
+				pairs[number_of_pairs++] = pairs[iterator_entry];
+			}
 		}
+		row_begin = row_end[iterator_virtual];
+	}
+	T->row_start[v_size] = number_of_pairs;
+	T->number_of_pairs = number_of_pairs;
+	T->column = (int *) malloc ((number_of_pairs + 1) *sizeof (int));
+	T->value = (traffic_t *) malloc ((number_of_pairs + 1) *sizeof (traffic_t));
+	T->row = (int *) malloc ((number_of_pairs + 1) *sizeof (int));
+	T->column_value = (traffic_t *) malloc ((number_of_pairs + 1) *sizeof (traffic_t));
+	for (iterator_pair = 0; iterator_pair < number_of_pairs; iterator_pair++)
+	{
+		if (pairs[iterator_pair].value > MAX_TRAFFIC || pairs[iterator_pair].value < 0)
+		{
+			free(row_end);
+			free(pairs);
+			traffic_matrix_free(T);
+			return NULL;
+		}
+		T->column[iterator_pair] = pairs[iterator_pair].column;
+		T->value[iterator_pair] = (traffic_t) pairs[iterator_pair].value;
+		T->column_start[pairs[iterator_pair].column + 1]++;
+	}
+	/* transposed index: rows are visited in order, so the peers of each column stay sorted */
+	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	{
+		T->column_start[iterator_virtual + 1] += T->column_start[iterator_virtual];
+		row_end[iterator_virtual] = T->column_start[iterator_virtual];
 	}
-	fclose(datacenter_file);
+	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	{
+		for (iterator_pair = T->row_start[iterator_virtual]; iterator_pair < T->row_start[iterator_virtual + 1]; iterator_pair++)
+		{
+			column = T->column[iterator_pair];
+			T->row[row_end[column]] = iterator_virtual;
+			T->column_value[row_end[column]] = T->value[iterator_pair];
+			row_end[column]++;
+		}
+	}
+	free(row_end);
+	free(pairs);
 	return T;
 }
 
-/* load_G: load the values of G
+/* traffic_matrix_free: releases a sparse traffic matrix
+ * parameter: T matrix
+ * returns: nothing, it's void
+ */
+void traffic_matrix_free(struct traffic_matrix *T)
+{
+	if (T != NULL)
+	{
+		free(T->row_start);
+		free(T->column);
+		free(T->value);
+		free(T->column_start);
+		free(T->row);
+		free(T->column_value);
+		free(T);
+	}
+}
+
+/* network_topology_build: builds the links used by each physical machine and the pairs of physical machines sharing links
  * parameter: number of physical machines
  * parameter: number of network links
- * parameter: path to the datacenter file
- * returns: G matrix
+ * parameter: number of non-zero values of G
+ * parameter: link of each value, sorted
+ * parameter: physical machine of each value
+ * returns: network topology
  */
-int** load_G(int h_size, int l_size, char path_to_file[])
+struct network_topology * network_topology_build(int h_size, int l_size, int number_of_entries, int *links, int *physicals)
 {
-	/* datacenter file to read from */
-	FILE *datacenter_file;
-	/* line readed from file */
-	char input_line[TAM_BUFFER];
+	struct network_topology *topology = (struct network_topology *) malloc (sizeof (struct network_topology));
 	/* iterators */
-	int iterator_row = 0;
-	int iterator_column = 0;
-	int iterator_line = 0;
-	/* 1 if is reading the network topology block in the file */
-	int reading_topology = 0;
-	char *ptr;
-	/* memory reserve for l_size network links */
-	int **G = (int **) malloc (l_size *sizeof (int *));
- 	/* open the file for reading */
-	datacenter_file = fopen(path_to_file,"r");
-    /* if it is opened ok, we continue */    
-	if (datacenter_file != NULL) 
-	{ 
-		/* read until the end */
-		while(iterator_row < l_size)  
+	int iterator_entry;
+	int iterator_physical;
+	int iterator_link;
+	int iterator_position;
+	int iterator_position_again;
+	int physical_again;
+	int number_of_shared = 0;
+	int shared_size = h_size + 1;
+	/* physical machines connected to each link */
+	int *physical_start = (int *) calloc (l_size + 1, sizeof (int));
+	/* last physical machine that marked a peer, to count each shared pair once */
+	int *marked = (int *) malloc ((h_size + 1) *sizeof (int));
+
+	topology->h_size = h_size;
+	topology->l_size = l_size;
+	topology->link_start = (int *) calloc (h_size + 1, sizeof (int));
+	topology->link = (int *) malloc ((number_of_entries + 1) *sizeof (int));
+	/* count the links of each physical machine and the physical machines of each link */
+	for (iterator_entry = 0; iterator_entry < number_of_entries; iterator_entry++)
+	{
+		topology->link_start[physicals[iterator_entry] + 1]++;
+		physical_start[links[iterator_entry] + 1]++;
+	}
+	for (iterator_physical = 0; iterator_physical < h_size; iterator_physical++)
+	{
+		topology->link_start[iterator_physical + 1] += topology->link_start[iterator_physical];
+	}
+	for (iterator_link = 0; iterator_link < l_size; iterator_link++)
+	{
+		physical_start[iterator_link + 1] += physical_start[iterator_link];
+	}
+	/* fill the links of each physical machine, the entries are sorted by link so every list stays sorted */
+	memcpy(marked, topology->link_start, (h_size + 1) *sizeof (int));
+	for (iterator_entry = 0; iterator_entry < number_of_entries; iterator_entry++)
+	{
+		topology->link[marked[physicals[iterator_entry]]++] = links[iterator_entry];
+	}
+	/* pairs of physical machines connected to a common link */
+	topology->shared_start = (int *) calloc (h_size + 1, sizeof (int));
+	topology->shared_physical = (int *) malloc (shared_size *sizeof (int));
+	for (iterator_physical = 0; iterator_physical < h_size; iterator_physical++)
+	{
+		marked[iterator_physical] = -1;
+	}
+	for (iterator_physical = 0; iterator_physical < h_size; iterator_physical++)
+	{
+		topology->shared_start[iterator_physical] = number_of_shared;
+		for (iterator_position = topology->link_start[iterator_physical]; iterator_position < topology->link_start[iterator_physical + 1]; iterator_position++)
 		{
-			/* get line per line */
-			fgets(input_line, TAM_BUFFER, datacenter_file);
-			iterator_line++;
-			/* reset iterator of columns */
-			iterator_column = 0;
-			/* if the line is equal to L_HEADER, we begin the network topology block in the file */
-			if (strstr(input_line,L_HEADER) != NULL)
+			iterator_link = topology->link[iterator_position];
+			for (iterator_position_again = physical_start[iterator_link]; iterator_position_again < physical_start[iterator_link + 1]; iterator_position_again++)
 			{
-				reading_topology = 1;
+				physical_again = physicals[iterator_position_again];
+				if (physical_again > iterator_physical && marked[physical_again] != iterator_physical)
+				{
+					marked[physical_again] = iterator_physical;
+					if (number_of_shared == shared_size)
+					{
+						shared_size *= 2;
+						topology->shared_physical = (int *) realloc (topology->shared_physical, shared_size *sizeof (int));
+					}
+					topology->shared_physical[number_of_shared++] = physical_again;
+				}
 			}
-			/* if it's the correct block in the file, it is not the header and it is not a blank line, we count */			
-			if (reading_topology == 1 && strstr(input_line,L_HEADER) == NULL && strcmp(input_line, "\n") != 0)
+		}
+		/* sort the peers, they are searched by bisection */
+		for (iterator_position = topology->shared_start[iterator_physical] + 1; iterator_position < number_of_shared; iterator_position++)
+		{
+			physical_again = topology->shared_physical[iterator_position];
+			for (iterator_position_again = iterator_position; iterator_position_again > topology->shared_start[iterator_physical] &&
+				topology->shared_physical[iterator_position_again - 1] > physical_again; iterator_position_again--)
 			{
-				/* memory reserve for h_size physical machines */
-				G[iterator_row] = (int *) malloc (h_size *sizeof (int));
-				/* strtok first time and load the value */
-				ptr = strtok(input_line," \n\t");
-				sscanf(ptr,"%d",&G[iterator_row][iterator_column]);
-				/* load all the next tokens of the input line */
-				while( (ptr = strtok( NULL, "\t" )) != NULL )
-				{		
-					/* increment iterator of columns and load the value */
-					iterator_column++;
-					sscanf(ptr,"%d",&G[iterator_row][iterator_column]);
-				}
-				/* increment iterator of rows */
-				iterator_row++;
-			} 
+				topology->shared_physical[iterator_position_again] = topology->shared_physical[iterator_position_again - 1];
+			}
+			topology->shared_physical[iterator_position_again] = physical_again;
 		}
 	}
-	fclose(datacenter_file);
-	return G;
+	topology->shared_start[h_size] = number_of_shared;
+	free(physical_start);
+	free(marked);
+	return topology;
 }
 
-/* load_K: load the values of K
- * parameter: number of network links
- * parameter: path to the datacenter file
- * returns: K array
+/* network_topology_free: releases a network topology
+ * parameter: network topology
+ * returns: nothing, it's void
  */
-int* load_K(int l_size, char path_to_file[])
+void network_topology_free(struct network_topology *topology)
 {
-	/* datacenter file to read from */
-	FILE *datacenter_file;
-	/* line readed from file */
-	char input_line[TAM_BUFFER];
-	/* iterators */
-	int iterator_row = 0;
-	int iterator_line = 0;
-	/* 1 if is reading the network link capacity block in the file */
-	int reading_capacity = 0;
-	char *ptr;
-	/* memory reserve for l_size network links */
-	int *K = (int *) malloc (l_size *sizeof (int));
- 	/* open the file for reading */
-	datacenter_file = fopen(path_to_file,"r");
-    /* if it is opened ok, we continue */    
-	if (datacenter_file != NULL) 
-	{ 
-		/* read until the end */
-		while(iterator_row < l_size)  
+	if (topology != NULL)
+	{
+		free(topology->link_start);
+		free(topology->link);
+		free(topology->shared_start);
+		free(topology->shared_physical);
+		free(topology);
+	}
+}
+
+/* find_shared_pair: searches a pair of physical machines in the shared pairs of the topology
+ * parameter: network topology
+ * parameter: first physical machine (0-based)
+ * parameter: second physical machine (0-based), bigger than the first one
+ * returns: position of the pair, -1 if both physical machines do not share links
+ */
+static int find_shared_pair(struct network_topology *topology, int physical, int physical_again)
+{
+	int low = topology->shared_start[physical];
+	int high = topology->shared_start[physical + 1] - 1;
+	int middle;
+	while (low <= high)
+	{
+		middle = (low + high) / 2;
+		if (topology->shared_physical[middle] == physical_again)
 		{
-			/* get line per line */
-			fgets(input_line, TAM_BUFFER, datacenter_file);
-			iterator_line++;
-			/* if the line is equal to C_HEADER, we begin the network link capacity block in the file */
-			if (strstr(input_line,C_HEADER) != NULL)
-			{
-				reading_capacity = 1;
-			}
-			/* if it's the correct block in the file, it is not the header and it is not a blank line, we count */			
-			if (reading_capacity == 1 && strstr(input_line,C_HEADER) == NULL && strcmp(input_line, "\n") != 0)
-			{
-				/* strtok first time and load the value */
-				ptr = strtok(input_line," \n\t");
-				sscanf(ptr,"%d",&K[iterator_row]);
-				/* load all the next tokens of the input line */
-				/* increment iterator of rows */
-				iterator_row++;
-			} 
+			return middle;
+		}
+		if (topology->shared_physical[middle] < physical_again)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle - 1;
 		}
 	}
-	fclose(datacenter_file);
-	return K;
+	return -1;
 }
 
-/* load_network_utilization: loads the utilization of the network links of all the individuals
- * parameter: population matrix
- * parameter: network topology matrix
- * parameter: network link capacity array
- * parameter: number of individuals
- * parameter: number of network links
- * parameter: number of virtual machines
- * returns: network utilization tridimentional matrix
+/* context of the network utilization task */
+struct network_context
+{
+	struct population *population;
+	struct network_topology *topology;
+	struct traffic_matrix *T;
+	/* scratch space of each thread */
+	long long *physical_traffic;
+	long long *shared_traffic;
+};
+
+/* load_network_utilization_task: loads the utilization of the network links of a range of individuals
+ * parameter: network context
+ * parameter: first individual
+ * parameter: end of the range of individuals
+ * parameter: thread running the task, it selects the scratch space
+ * returns: nothing, it's void
  */
-int** load_network_utilization(int **population, int **G, int **T, int number_of_individuals, int l_size, int v_size)
+static void load_network_utilization_task(void *context, int begin, int end, int thread)
 {
+	struct population *population = ((struct network_context *) context)->population;
+	struct network_topology *topology = ((struct network_context *) context)->topology;
+	struct traffic_matrix *T = ((struct network_context *) context)->T;
 	/* iterators */
 	int iterator_individual;
 	int iterator_virtual;
-	int iterator_virtual_again;
-	int iterator_link;
-	/* utilization holds the utilization of network links of each individual */
-	int **network_utilization = (int **) malloc (number_of_individuals *sizeof (int *));
+	int iterator_pair;
+	int iterator_physical;
+	int iterator_position;
+	int iterator_position_again;
+	int shared_pair;
+	/* physical positions of both virtual machines of a pair */
+	int physical_position;
+	int physical_position_again;
+	/* genes and network utilization of the current individual */
+	int *individual;
+	long long *network_utilization;
+	/* traffic leaving each physical machine, and traffic between each pair of physical machines sharing links */
+	long long *physical_traffic = ((struct network_context *) context)->physical_traffic + (size_t) thread * (population->h_size + 1);
+	long long *shared_traffic = ((struct network_context *) context)->shared_traffic + (size_t) thread * (topology->shared_start[population->h_size] + 1);
 	/* iterate on individuals */	
-	for (iterator_individual=0; iterator_individual < number_of_individuals; iterator_individual++)
+	for (iterator_individual = begin; iterator_individual < end; iterator_individual++)
 	{
-		/* network utilization matrix, holds the utilization of network links per individual */
-		network_utilization[iterator_individual] = (int *) malloc (l_size *sizeof (int));
-		for (iterator_link=0; iterator_link < l_size; iterator_link++)
+		individual = GENES(population, iterator_individual);
+		network_utilization = NETWORK_UTILIZATION(population, iterator_individual);
+		/* network links utilization. Initialized to 0 */
+		memset(network_utilization, 0, population->l_size * sizeof (long long));
+		memset(physical_traffic, 0, population->h_size * sizeof (long long));
+		memset(shared_traffic, 0, topology->shared_start[population->h_size] * sizeof (long long));
+		/* reduce the placement to the traffic between physical machines */
+		for (iterator_virtual=0; iterator_virtual < population->v_size; iterator_virtual++)
 		{
-			/* initialize link value */
-			network_utilization[iterator_individual][iterator_link] = 0;
+			physical_position = individual[iterator_virtual];
+			if (physical_position == 0)
+			{
+				continue;
+			}
+			for (iterator_pair = T->row_start[iterator_virtual]; iterator_pair < T->row_start[iterator_virtual + 1]; iterator_pair++)
+			{
+				physical_position_again = individual[T->column[iterator_pair]];
+				/* consider only traffic between virtual machines in different physical machines for placed only virtual machines */
+				if (physical_position != physical_position_again && physical_position_again != 0)
+				{
+					physical_traffic[physical_position - 1] += T->value[iterator_pair];
+					physical_traffic[physical_position_again - 1] += T->value[iterator_pair];
+					shared_pair = physical_position < physical_position_again ?
+						find_shared_pair(topology, physical_position - 1, physical_position_again - 1) :
+						find_shared_pair(topology, physical_position_again - 1, physical_position - 1);
+					if (shared_pair >= 0)
+					{
+						shared_traffic[shared_pair] += T->value[iterator_pair];
+					}
+				}
+			}
 		}
-		/* for each virtual machine in T, add the corresponding traffic to other virtual machines */
-		for (iterator_virtual=0; iterator_virtual < v_size; iterator_virtual++)
+		/* each link carries the traffic of every physical machine connected to it */
+		for (iterator_physical = 0; iterator_physical < population->h_size; iterator_physical++)
 		{
-			for (iterator_virtual_again=0; iterator_virtual_again < v_size; iterator_virtual_again++)
+			if (physical_traffic[iterator_physical] == 0)
 			{
-				/* consider only traffic between virtual machines in different physical machines for placed only virtual machines */
-				if (population[iterator_individual][iterator_virtual] != population[iterator_individual][iterator_virtual_again] && 				
-					population[iterator_individual][iterator_virtual] != 0 && population[iterator_individual][iterator_virtual_again] != 0)
+				continue;
+			}
+			for (iterator_position = topology->link_start[iterator_physical]; iterator_position < topology->link_start[iterator_physical + 1]; iterator_position++)
+			{
+				network_utilization[topology->link[iterator_position]] += physical_traffic[iterator_physical];
+			}
+			/* the traffic between two physical machines of the same link was added twice to that link */
+			for (shared_pair = topology->shared_start[iterator_physical]; shared_pair < topology->shared_start[iterator_physical + 1]; shared_pair++)
+			{
+				if (shared_traffic[shared_pair] == 0)
 				{
-					/* for each network link */
-					for (iterator_link=0; iterator_link < l_size; iterator_link++)
+					continue;
+				}
+				physical_position_again = topology->shared_physical[shared_pair];
+				iterator_position = topology->link_start[iterator_physical];
+				iterator_position_again = topology->link_start[physical_position_again];
+				while (iterator_position < topology->link_start[iterator_physical + 1] &&
+					iterator_position_again < topology->link_start[physical_position_again + 1])
+				{
+					if (topology->link[iterator_position] == topology->link[iterator_position_again])
+					{
+						network_utilization[topology->link[iterator_position]] -= shared_traffic[shared_pair];
+						iterator_position++;
+						iterator_position_again++;
+					}
+					else if (topology->link[iterator_position] < topology->link[iterator_position_again])
 					{
-						/* add the corresponding traffic for each used link */
-						if (G[population[iterator_individual][iterator_virtual]-1][iterator_link] !=0 || 
-							G[population[iterator_individual][iterator_virtual_again]-1][iterator_link] !=0)
-						{						
-							network_utilization[iterator_individual][iterator_link] += T[iterator_virtual][iterator_virtual_again];
-						}
+						iterator_position++;
+					}
+					else
+					{
+						iterator_position_again++;
 					}
 				}
 			}
-		}			
+		}
+	}
+}
+
+/* load_network_utilization: loads the utilization of the network links of all the individuals
+ * parameter: population arena, its network utilization block is overwritten
+ * parameter: network topology
+ * parameter: network traffic matrix
+ * parameter: task pool running the individuals in parallel, NULL to run them on the calling thread
+ * parameter: scratch arena for the traffic of each thread, NULL to allocate it for this call
+ * returns: nothing, it's void
+ */
+void load_network_utilization(struct population *population, struct network_topology *topology, struct traffic_matrix *T, struct pool *pool,
+	struct scratch *scratch)
+{
+	struct network_context context;
+	struct scratch *temporary = NULL;
+	size_t mark;
+	if (scratch == NULL)
+	{
+		scratch = temporary = scratch_create(0);
 	}
-	return network_utilization;
+	mark = scratch_mark(scratch);
+	context.population = population;
+	context.topology = topology;
+	context.T = T;
+	context.physical_traffic = (long long *) scratch_alloc (scratch, (size_t) pool_size(pool) * (population->h_size + 1) * sizeof (long long));
+	context.shared_traffic = (long long *) scratch_alloc (scratch, (size_t) pool_size(pool) * (topology->shared_start[population->h_size] + 1) * sizeof (long long));
+	pool_run(pool, population->number_of_individuals, POOL_AUTO_CHUNK, load_network_utilization_task, &context);
+	scratch_release(scratch, mark);
+	scratch_free(temporary);
 }
@@ -11,16 +11,16 @@
 #include <stdlib.h>
 #include <math.h>
 #include <time.h>
-/* definitions */
-#define T_HEADER "NETWORK TRAFFIC"
-#define L_HEADER "NETWORK TOPOLOGY"
-#define C_HEADER "NETWORK LINK CAPACITY"
-#define TAM_BUFFER BUFSIZ
-/* get the number of network links */
-int get_l_size(char path_to_file[]);
-/* load datacenter network topology */
-int** load_T(int v_size, char path_to_file[]);
-int** load_G(int h_size, int l_size, char path_to_file[]);
-int* load_K(int l_size, char path_to_file[]);
+/* include population arena header */
+#include "population.h"
+#include "datacenter.h"
+#include "pool.h"
+#include "scratch.h"
+/* build the datacenter network traffic and topology */
+struct traffic_matrix * traffic_matrix_build(int v_size, int number_of_entries, int *rows, int *columns, int *values);
+void traffic_matrix_free(struct traffic_matrix *T);
+struct network_topology * network_topology_build(int h_size, int l_size, int number_of_entries, int *links, int *physicals);
+void network_topology_free(struct network_topology *topology);
 /* load utilization of network resources */
-int** load_network_utilization(int **population, int **G, int **T, int number_of_individuals, int l_size, int v_size);
+void load_network_utilization(struct population *population, struct network_topology *topology, struct traffic_matrix *T, struct pool *pool,
+	struct scratch *scratch);
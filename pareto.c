@@ -15,25 +15,26 @@
 #include "pareto.h"
 #include "common.h"
 #include "network.h"
-
-/* structure of an element */
-struct pareto_element
-{
-	int *solution;
-	float *costs;
-	struct pareto_element *prev;
-	struct pareto_element *next;
-};
+#include "variation.h"
 
 struct pareto_element * pareto_create(int v_size, int *individual, float *objectives_functions)
 {
 	struct pareto_element *pareto_current = (struct pareto_element *) malloc (sizeof(struct pareto_element));
+	int iterator_objective;
 	pareto_current->solution = (int *) malloc (v_size *sizeof(int));
-	pareto_current->costs = (float *) malloc (5 *sizeof(float));
-	pareto_current->solution = individual;
-	pareto_current->costs = objectives_functions;
+	pareto_current->costs = (float *) malloc (NUMBER_OF_OBJECTIVES *sizeof(float));
+	/* the population arenas are reused, so the archive keeps its own copy */
+	memcpy(pareto_current->solution, individual, v_size * sizeof (int));
+	memcpy(pareto_current->costs, objectives_functions, NUMBER_OF_OBJECTIVES * sizeof (float));
 	pareto_current->prev = NULL;
 	pareto_current->next = NULL;
+	pareto_current->hash = 0;
+	pareto_current->hash_next = NULL;
+	/* every objective of the key is minimized */
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		pareto_current->key[iterator_objective] = objectives_functions[iterator_objective] * objective_sense[iterator_objective];
+	}
 	return pareto_current;
 }
 
@@ -65,6 +66,9 @@ struct pareto_element * pareto_insert(struct pareto_element *pareto_head, int v_
 			}
 			if(duplicate == 1)
 			{
+				free(pareto_current->solution);
+				free(pareto_current->costs);
+				free(pareto_current);
 				return pareto_head;
 			}
 			duplicate = 1;
@@ -199,11 +203,11 @@ int load_pareto_size(struct pareto_element *pareto_head)
 	return size;
 }
 
-void report_best_population(struct pareto_element *pareto_head, int **G, int **T, int **H, int **V, int v_size, int h_size, int l_size)
+void report_best_population(struct pareto_element *pareto_head, struct network_topology *topology, struct traffic_matrix *T, int **V, int v_size, int h_size, int l_size)
 {
 	int pareto_size = load_pareto_size(pareto_head);
-	int **best_P = (int **) malloc (pareto_size *sizeof (int *));
-	float **objective_functions_best_P = (float **) malloc (pareto_size *sizeof (float *));
+	/* the known Pareto set is copied into a population arena to reuse the evaluation stages */
+	struct population *best_P = population_create(pareto_size, h_size, v_size, l_size);
 	FILE *pareto_set;
 	FILE *pareto_front;
 	FILE *pareto_network_utilization;
@@ -220,60 +224,157 @@ void report_best_population(struct pareto_element *pareto_head, int **G, int **T
 	int iterator_virtual;
 	int iterator_link;
 	int iterator_physical;
+	/* rows of the current individual */
+	int *individual;
+	int *utilization;
+	long long *network_utilization;
+	float *objectives;
 	/* copying pareto individuals */	
 	for (iterator_individual=0; iterator_individual < pareto_size; iterator_individual++)
 	{
-		best_P[iterator_individual] = (int *) malloc (v_size *sizeof (int));
-		objective_functions_best_P[iterator_individual] = (float *) malloc (5 *sizeof (float));
-		best_P[iterator_individual] = pareto_head->solution;
-		objective_functions_best_P[iterator_individual] = pareto_head->costs;
+		memcpy(GENES(best_P, iterator_individual), pareto_head->solution, v_size * sizeof (int));
+		memcpy(OBJECTIVES(best_P, iterator_individual), pareto_head->costs, NUMBER_OF_OBJECTIVES * sizeof (float));
 		pareto_head = pareto_head->next;
 	}
-	/* once the best population is on a matrix, non-dominated sorting is performed */
-	int *fronts_best_P = (int *) non_dominated_sorting(objective_functions_best_P, pareto_size);
-	int ***utilization_best_P = load_utilization(best_P, H, V, pareto_size, h_size, v_size);
-	int **network_utilization_best_P = load_network_utilization(best_P, G, T, pareto_size, l_size, v_size);
+	load_utilization(best_P, V, NULL);
+	load_network_utilization(best_P, topology, T, NULL, NULL);
 	/* save the Pareto set and the Pareto front */
 	/* for each individual */
 	for (iterator_individual=0; iterator_individual < pareto_size; iterator_individual++)
 	{
-		/* only the first pareto front */
-		if(fronts_best_P[iterator_individual]==1)
+		/* the archive only holds non-dominated solutions, all of them are in the first pareto front */
+		individual = GENES(best_P, iterator_individual);
+		utilization = UTILIZATION(best_P, iterator_individual);
+		network_utilization = NETWORK_UTILIZATION(best_P, iterator_individual);
+		objectives = OBJECTIVES(best_P, iterator_individual);
+		/* Pareto set */
+		for (iterator_virtual = 0; iterator_virtual < v_size ; iterator_virtual++)
 		{
-			/* Pareto set */
-			for (iterator_virtual = 0; iterator_virtual < v_size ; iterator_virtual++)
-			{
-				/* for each element of the individual/solution */
-				fprintf(pareto_set,"%d\t",best_P[iterator_individual][iterator_virtual]);
-			}
-			fprintf(pareto_set,"\n");
+			/* for each element of the individual/solution */
+			fprintf(pareto_set,"%d\t",individual[iterator_virtual]);
+		}
+		fprintf(pareto_set,"\n");
+
+		/* Pareto front */
+		fprintf(pareto_front,"%g\t%g\t%g\t%g\t%g\n",objectives[0],objectives[1],objectives[2],objectives[3],objectives[4]);
+
+		/* network link utilization */
+		for (iterator_link = 0; iterator_link < l_size ; iterator_link++)
+		{
+			/* for each element of the individual/solution */
+			fprintf(pareto_network_utilization,"%lld\t",network_utilization[iterator_link]);
+		}
+		fprintf(pareto_network_utilization,"\n");
 
-			/* Pareto front */
-			fprintf(pareto_front,"%g\t%g\t%g\t%g\t%g\n",objective_functions_best_P[iterator_individual][0],objective_functions_best_P[iterator_individual][1], 
-			objective_functions_best_P[iterator_individual][2],objective_functions_best_P[iterator_individual][3],objective_functions_best_P[iterator_individual][4]);
+		/* physical resources utilization */
+		for (iterator_physical = 0; iterator_physical < h_size ; iterator_physical++)
+		{
+			/* for each physical resource */
+			fprintf(pareto_cpu_utilization,"%d\t",utilization[iterator_physical * NUMBER_OF_RESOURCES]);
+			fprintf(pareto_ram_utilization,"%d\t",utilization[iterator_physical * NUMBER_OF_RESOURCES + 1]);
+			fprintf(pareto_hdd_utilization,"%d\t",utilization[iterator_physical * NUMBER_OF_RESOURCES + 2]);
+		}
+		fprintf(pareto_cpu_utilization,"\n");
+		fprintf(pareto_ram_utilization,"\n");
+		fprintf(pareto_hdd_utilization,"\n");
+	}
+	fclose(pareto_set);
+	fclose(pareto_front);
+	fclose(pareto_network_utilization);
+	fclose(pareto_cpu_utilization);
+	fclose(pareto_ram_utilization);
+	fclose(pareto_hdd_utilization);
+	population_free(best_P);
+	return;
+}
+
+/* pareto_set_size: counts the placements of a Pareto set file
+ * parameter: path to the Pareto set file
+ * returns: number of placements, -1 if the file can not be read
+ */
+int pareto_set_size(const char *path_to_file)
+{
+	FILE *pareto_set = fopen(path_to_file, "r");
+	char *input_line = NULL;
+	size_t line_size = 0;
+	int number_of_lines = 0;
+	if (pareto_set == NULL)
+	{
+		printf("[ERROR] can not open the Pareto set file %s\n", path_to_file);
+		return -1;
+	}
+	while (getline(&input_line, &line_size, pareto_set) != -1)
+	{
+		if (input_line[strspn(input_line, " \t\r\n")] != '\0')
+		{
+			number_of_lines++;
+		}
+	}
+	free(input_line);
+	fclose(pareto_set);
+	return number_of_lines;
+}
 
-			/* network link utilization */
-			for (iterator_link = 0; iterator_link < l_size ; iterator_link++)
+/* pareto_seed_population: seeds the first individuals of a population with the placements of a Pareto set file,
+ * one placement per line as written by report_best_population. The file is appended to by every run, so the last
+ * lines are taken. The virtual machines keep their index: the extra genes of a line are dropped, and the virtual
+ * machines missing from a line, placed on a physical machine that does not exist anymore, or not placed while their
+ * placement is mandatory keep the gene they already had
+ * parameter: path to the Pareto set file
+ * parameter: population arena, already initialized
+ * parameter: virtual machines requirements matrix
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * returns: number of seeded individuals, -1 if the file can not be read
+ */
+int pareto_seed_population(const char *path_to_file, struct population *population, int **V, int max_SLA)
+{
+	FILE *pareto_set;
+	char *input_line = NULL;
+	size_t line_size = 0;
+	char *position;
+	char *end;
+	long gene;
+	/* iterators */
+	int iterator_line = 0;
+	int iterator_virtual;
+	/* count the placements, to take the last ones */
+	int number_of_lines = pareto_set_size(path_to_file);
+	int first_line;
+	int number_of_seeds = 0;
+	int *individual;
+	if (number_of_lines < 0 || (pareto_set = fopen(path_to_file, "r")) == NULL)
+	{
+		return -1;
+	}
+	first_line = number_of_lines > population->number_of_individuals ? number_of_lines - population->number_of_individuals : 0;
+	while (getline(&input_line, &line_size, pareto_set) != -1)
+	{
+		position = input_line + strspn(input_line, " \t\r\n");
+		if (*position == '\0' || iterator_line++ < first_line)
+		{
+			continue;
+		}
+		individual = GENES(population, number_of_seeds);
+		for (iterator_virtual = 0; *position != '\0'; iterator_virtual++)
+		{
+			gene = strtol(position, &end, 10);
+			if (end == position)
 			{
-				/* for each element of the individual/solution */
-				fprintf(pareto_network_utilization,"%d\t",network_utilization_best_P[iterator_individual][iterator_link]);
+				printf("[ERROR] %s:%d: expected the physical machine of each virtual machine\n", path_to_file, iterator_line);
+				free(input_line);
+				fclose(pareto_set);
+				return -1;
 			}
-			fprintf(pareto_network_utilization,"\n");
-
-			/* physical resources utilization */
-			for (iterator_physical = 0; iterator_physical < h_size ; iterator_physical++)
+			position = end + strspn(end, " \t\r\n");
+			if (iterator_virtual < population->v_size && gene >= 0 && gene <= population->h_size &&
+				(gene != 0 || V[iterator_virtual][3] != max_SLA))
 			{
-				/* for each physical resource */
-				fprintf(pareto_cpu_utilization,"%d\t",utilization_best_P[iterator_individual][iterator_physical][0]);
-				fprintf(pareto_ram_utilization,"%d\t",utilization_best_P[iterator_individual][iterator_physical][1]);
-				fprintf(pareto_hdd_utilization,"%d\t",utilization_best_P[iterator_individual][iterator_physical][2]);
+				individual[iterator_virtual] = (int) gene;
 			}
-			fprintf(pareto_cpu_utilization,"\n");
-			fprintf(pareto_ram_utilization,"\n");
-			fprintf(pareto_hdd_utilization,"\n");
 		}
+		number_of_seeds++;
 	}
+	free(input_line);
 	fclose(pareto_set);
-	fclose(pareto_front);
-	return;
+	return number_of_seeds;
 }
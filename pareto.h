@@ -5,6 +5,9 @@
  * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
  */
 
+/* include datacenter instance and Pareto archive headers */
+#include "datacenter.h"
+#include "archive.h"
 /* include functions */
 struct pareto_element * pareto_create(int v_size, int *individual, float *objectives_functions);
 struct pareto_element * pareto_insert(struct pareto_element *pareto_head, int v_size, int *individual, float *objectives_functions);
@@ -14,4 +17,6 @@ float get_max_cost(struct pareto_element *pareto_head, int objective);
 void print_pareto_set(struct pareto_element *pareto_head, int v_size);
 void print_pareto_front(struct pareto_element *pareto_head);
 int load_pareto_size(struct pareto_element *pareto_head);
-void report_best_population(struct pareto_element *pareto_head, int **G, int **T, int **H, int **V, int v_size, int h_size, int l_size);
+int pareto_set_size(const char *path_to_file);
+int pareto_seed_population(const char *path_to_file, struct population *population, int **V, int max_SLA);
+void report_best_population(struct pareto_element *pareto_head, struct network_topology *topology, struct traffic_matrix *T, int **V, int v_size, int h_size, int l_size);
@@ -0,0 +1,226 @@
+/*
+ * pool.c: Virtual Machine Placement Problem - Work-Stealing Task Pool
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include task pool header */
+#include "pool.h"
+
+/* take_chunk: takes the next chunk from the bottom of the own deque, or steals one from the top of another deque
+ * parameter: task pool
+ * parameter: thread that takes the chunk
+ * returns: index of the chunk, -1 if every deque is empty
+ */
+static int take_chunk(struct pool *pool, int thread)
+{
+	/* iterator */
+	int iterator_thread;
+	int victim;
+	int chunk = -1;
+	struct pool_deque *deque = &pool->deques[thread];
+	pthread_mutex_lock(&deque->mutex);
+	if (deque->top < deque->bottom)
+	{
+		chunk = --deque->bottom;
+	}
+	pthread_mutex_unlock(&deque->mutex);
+	/* steal starting from the next thread, so the thieves do not pile on the same victim */
+	for (iterator_thread = 1; chunk < 0 && iterator_thread < pool->number_of_threads; iterator_thread++)
+	{
+		victim = (thread + iterator_thread) % pool->number_of_threads;
+		deque = &pool->deques[victim];
+		pthread_mutex_lock(&deque->mutex);
+		if (deque->top < deque->bottom)
+		{
+			chunk = deque->top++;
+		}
+		pthread_mutex_unlock(&deque->mutex);
+	}
+	return chunk;
+}
+
+/* run_chunks: runs chunks of the actual job until there is nothing left to take or steal
+ * parameter: task pool
+ * parameter: thread that runs the chunks
+ * returns: nothing, it's void
+ */
+static void run_chunks(struct pool *pool, int thread)
+{
+	int chunk;
+	int begin;
+	int end;
+	while ((chunk = take_chunk(pool, thread)) >= 0)
+	{
+		begin = chunk * pool->chunk_size;
+		end = begin + pool->chunk_size < pool->number_of_items ? begin + pool->chunk_size : pool->number_of_items;
+		pool->task(pool->context, begin, end, thread);
+	}
+}
+
+/* worker: body of the threads of the pool, waits for a job, works on it and reports it done
+ * parameter: deque of the thread, it points to the pool and its index is the thread
+ * returns: NULL
+ */
+static void * worker(void *argument)
+{
+	struct pool_deque *deque = (struct pool_deque *) argument;
+	struct pool *pool = deque->pool;
+	int thread = (int) (deque - pool->deques);
+	unsigned long job = 0;
+	for (;;)
+	{
+		pthread_mutex_lock(&pool->mutex);
+		while (pool->job == job && !pool->shutdown)
+		{
+			pthread_cond_wait(&pool->start, &pool->mutex);
+		}
+		if (pool->shutdown)
+		{
+			pthread_mutex_unlock(&pool->mutex);
+			return NULL;
+		}
+		job = pool->job;
+		pthread_mutex_unlock(&pool->mutex);
+		run_chunks(pool, thread);
+		pthread_mutex_lock(&pool->mutex);
+		if (--pool->working == 0)
+		{
+			pthread_cond_signal(&pool->done);
+		}
+		pthread_mutex_unlock(&pool->mutex);
+	}
+}
+
+/* pool_create: creates a task pool and starts its threads
+ * parameter: number of threads, counting the calling one, POOL_ALL_CORES for one per online core
+ * returns: task pool
+ */
+struct pool * pool_create(int number_of_threads)
+{
+	/* iterator */
+	int iterator_thread;
+	struct pool *pool = (struct pool *) malloc (sizeof (struct pool));
+	if (number_of_threads == POOL_ALL_CORES)
+	{
+		number_of_threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	if (number_of_threads < 1)
+	{
+		number_of_threads = 1;
+	}
+	pool->number_of_threads = number_of_threads;
+	pool->threads = (pthread_t *) malloc (number_of_threads * sizeof (pthread_t));
+	pool->deques = (struct pool_deque *) malloc (number_of_threads * sizeof (struct pool_deque));
+	pthread_mutex_init(&pool->mutex, NULL);
+	pthread_cond_init(&pool->start, NULL);
+	pthread_cond_init(&pool->done, NULL);
+	pool->job = 0;
+	pool->working = 0;
+	pool->shutdown = 0;
+	for (iterator_thread = 0; iterator_thread < number_of_threads; iterator_thread++)
+	{
+		pool->deques[iterator_thread].pool = pool;
+		pthread_mutex_init(&pool->deques[iterator_thread].mutex, NULL);
+		pool->deques[iterator_thread].top = 0;
+		pool->deques[iterator_thread].bottom = 0;
+	}
+	for (iterator_thread = 1; iterator_thread < number_of_threads; iterator_thread++)
+	{
+		pthread_create(&pool->threads[iterator_thread], NULL, worker, &pool->deques[iterator_thread]);
+	}
+	return pool;
+}
+
+/* pool_free: stops the threads of a task pool and releases it
+ * parameter: task pool
+ * returns: nothing, it's void
+ */
+void pool_free(struct pool *pool)
+{
+	/* iterator */
+	int iterator_thread;
+	if (pool == NULL)
+	{
+		return;
+	}
+	pthread_mutex_lock(&pool->mutex);
+	pool->shutdown = 1;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->mutex);
+	for (iterator_thread = 1; iterator_thread < pool->number_of_threads; iterator_thread++)
+	{
+		pthread_join(pool->threads[iterator_thread], NULL);
+	}
+	for (iterator_thread = 0; iterator_thread < pool->number_of_threads; iterator_thread++)
+	{
+		pthread_mutex_destroy(&pool->deques[iterator_thread].mutex);
+	}
+	pthread_mutex_destroy(&pool->mutex);
+	pthread_cond_destroy(&pool->start);
+	pthread_cond_destroy(&pool->done);
+	free(pool->deques);
+	free(pool->threads);
+	free(pool);
+}
+
+/* pool_size: number of threads of a task pool
+ * parameter: task pool, NULL means the calling thread only
+ * returns: number of threads, the bound of the thread argument of the tasks
+ */
+int pool_size(struct pool *pool)
+{
+	return pool == NULL ? 1 : pool->number_of_threads;
+}
+
+/* pool_run: runs a task over the items [0, number of items) split in chunks, and waits for it to finish.
+ * Each thread starts with a contiguous range of chunks and steals from the others when it runs out,
+ * so the results only depend on what the task does with each item, not on the number of threads
+ * parameter: task pool, NULL runs the task on the calling thread
+ * parameter: number of items
+ * parameter: number of items per chunk, POOL_AUTO_CHUNK for POOL_CHUNKS_PER_THREAD chunks per thread
+ * parameter: task
+ * parameter: context of the task
+ * returns: nothing, it's void
+ */
+void pool_run(struct pool *pool, int number_of_items, int chunk_size, pool_task task, void *context)
+{
+	/* iterator */
+	int iterator_thread;
+	int number_of_chunks;
+	if (number_of_items <= 0)
+	{
+		return;
+	}
+	if (pool == NULL || pool->number_of_threads == 1)
+	{
+		task(context, 0, number_of_items, 0);
+		return;
+	}
+	if (chunk_size == POOL_AUTO_CHUNK)
+	{
+		chunk_size = (number_of_items + pool->number_of_threads * POOL_CHUNKS_PER_THREAD - 1) / (pool->number_of_threads * POOL_CHUNKS_PER_THREAD);
+	}
+	number_of_chunks = (number_of_items + chunk_size - 1) / chunk_size;
+	pthread_mutex_lock(&pool->mutex);
+	pool->task = task;
+	pool->context = context;
+	pool->number_of_items = number_of_items;
+	pool->chunk_size = chunk_size;
+	for (iterator_thread = 0; iterator_thread < pool->number_of_threads; iterator_thread++)
+	{
+		pool->deques[iterator_thread].top = (int) ((long long) number_of_chunks * iterator_thread / pool->number_of_threads);
+		pool->deques[iterator_thread].bottom = (int) ((long long) number_of_chunks * (iterator_thread + 1) / pool->number_of_threads);
+	}
+	pool->working = pool->number_of_threads - 1;
+	pool->job++;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->mutex);
+	run_chunks(pool, 0);
+	pthread_mutex_lock(&pool->mutex);
+	while (pool->working > 0)
+	{
+		pthread_cond_wait(&pool->done, &pool->mutex);
+	}
+	pthread_mutex_unlock(&pool->mutex);
+}
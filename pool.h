@@ -0,0 +1,64 @@
+/*
+ * pool.h: Virtual Machine Placement Problem - Work-Stealing Task Pool Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+/* definitions */
+#define POOL_ALL_CORES 0
+#define POOL_AUTO_CHUNK 0
+#define POOL_CHUNKS_PER_THREAD 4
+
+/* task pool */
+struct pool;
+
+/* task over the items [begin, end) run by a thread of the pool, thread is in [0, number of threads) */
+typedef void (*pool_task)(void *context, int begin, int end, int thread);
+
+/* deque of chunks of a thread: the chunks [top, bottom) are still pending,
+ * the owner takes them from the bottom and the other threads steal them from the top */
+struct pool_deque
+{
+	struct pool *pool;
+	pthread_mutex_t mutex;
+	int top;
+	int bottom;
+};
+
+/* structure of the task pool: the calling thread works as thread 0 */
+struct pool
+{
+	int number_of_threads;
+	pthread_t *threads;
+	struct pool_deque *deques;
+	/* actual job, published under the mutex of the pool */
+	pthread_mutex_t mutex;
+	pthread_cond_t start;
+	pthread_cond_t done;
+	unsigned long job;
+	int working;
+	int shutdown;
+	pool_task task;
+	void *context;
+	int number_of_items;
+	int chunk_size;
+};
+
+/* function headers definitions */
+struct pool * pool_create(int number_of_threads);
+void pool_free(struct pool *pool);
+int pool_size(struct pool *pool);
+void pool_run(struct pool *pool, int number_of_items, int chunk_size, pool_task task, void *context);
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * population.c: Virtual Machine Placement Problem - Population Arena
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include population arena header */
+#include "population.h"
+
+/* align_size: rounds a block size up to the arena alignment
+ * parameter: size of the block in bytes
+ * returns: aligned size of the block in bytes
+ */
+static size_t align_size(size_t size)
+{
+	return (size + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT;
+}
+
+/* population_create: reserves a population arena with a single allocation
+ * parameter: number of individuals
+ * parameter: number of physical machines
+ * parameter: number of virtual machines
+ * parameter: number of network links
+ * returns: population arena, with every block initialized to 0
+ */
+struct population * population_create(int number_of_individuals, int h_size, int v_size, int l_size)
+{
+	struct population *population = (struct population *) malloc (sizeof (struct population));
+	/* size of each block of the arena */
+	size_t genes_size = align_size((size_t) number_of_individuals * v_size * sizeof (int));
+	size_t utilization_size = align_size((size_t) number_of_individuals * h_size * NUMBER_OF_RESOURCES * sizeof (int));
+	size_t network_utilization_size = align_size((size_t) number_of_individuals * l_size * sizeof (long long));
+	size_t objectives_size = align_size((size_t) number_of_individuals * NUMBER_OF_OBJECTIVES * sizeof (float));
+	size_t feasible_size = align_size((size_t) number_of_individuals * sizeof (int));
+	char *block;
+
+	population->number_of_individuals = number_of_individuals;
+	population->h_size = h_size;
+	population->v_size = v_size;
+	population->l_size = l_size;
+	/* memory reserve for the whole arena, aligned so every block starts on a cache line */
+	if (posix_memalign(&population->arena, ARENA_ALIGNMENT, genes_size + utilization_size + network_utilization_size + objectives_size + feasible_size) != 0)
+	{
+		printf("[ERROR] not enough memory for a population of %d individuals\n", number_of_individuals);
+		exit(1);
+	}
+	memset(population->arena, 0, genes_size + utilization_size + network_utilization_size + objectives_size + feasible_size);
+	/* carve the blocks out of the arena */
+	block = (char *) population->arena;
+	population->genes = (int *) block;
+	block += genes_size;
+	population->utilization = (int *) block;
+	block += utilization_size;
+	population->network_utilization = (long long *) block;
+	block += network_utilization_size;
+	population->objectives = (float *) block;
+	block += objectives_size;
+	population->feasible = (int *) block;
+	return population;
+}
+
+/* population_free: releases a population arena
+ * parameter: population arena
+ * returns: nothing, it's void
+ */
+void population_free(struct population *population)
+{
+	if (population != NULL)
+	{
+		free(population->arena);
+		free(population);
+	}
+}
+
+/* population_view: fills a population that covers a range of individuals of another arena, it owns no memory
+ * parameter: population to fill, it is not released
+ * parameter: population arena holding the individuals
+ * parameter: first individual of the range
+ * parameter: number of individuals of the range
+ * returns: nothing, it's void
+ */
+void population_view(struct population *view, struct population *population, int first_individual, int number_of_individuals)
+{
+	view->number_of_individuals = number_of_individuals;
+	view->h_size = population->h_size;
+	view->v_size = population->v_size;
+	view->l_size = population->l_size;
+	view->genes = GENES(population, first_individual);
+	view->utilization = UTILIZATION(population, first_individual);
+	view->network_utilization = NETWORK_UTILIZATION(population, first_individual);
+	view->objectives = OBJECTIVES(population, first_individual);
+	view->feasible = population->feasible + first_individual;
+	view->arena = NULL;
+}
+
+/* population_copy_individual: copies an individual with its utilization, costs and feasibility between arenas
+ * parameter: destination population arena
+ * parameter: identificator of the individual in the destination
+ * parameter: source population arena
+ * parameter: identificator of the individual in the source
+ * returns: nothing, it's void
+ */
+void population_copy_individual(struct population *destination, int destination_individual, struct population *source, int source_individual)
+{
+	memcpy(GENES(destination, destination_individual), GENES(source, source_individual), source->v_size * sizeof (int));
+	memcpy(UTILIZATION(destination, destination_individual), UTILIZATION(source, source_individual),
+		source->h_size * NUMBER_OF_RESOURCES * sizeof (int));
+	memcpy(NETWORK_UTILIZATION(destination, destination_individual), NETWORK_UTILIZATION(source, source_individual),
+		source->l_size * sizeof (long long));
+	memcpy(OBJECTIVES(destination, destination_individual), OBJECTIVES(source, source_individual),
+		NUMBER_OF_OBJECTIVES * sizeof (float));
+	destination->feasible[destination_individual] = source->feasible[source_individual];
+}
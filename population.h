@@ -0,0 +1,57 @@
+/*
+ * population.h: Virtual Machine Placement Problem - Population Arena Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef POPULATION_H
+#define POPULATION_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* definitions */
+#define NUMBER_OF_RESOURCES 3
+#define NUMBER_OF_OBJECTIVES 5
+#define ARENA_ALIGNMENT 64
+/* row accessors of the population arena */
+#define GENES(population, individual) \
+	((population)->genes + (size_t)(individual) * (population)->v_size)
+#define UTILIZATION(population, individual) \
+	((population)->utilization + (size_t)(individual) * (population)->h_size * NUMBER_OF_RESOURCES)
+#define NETWORK_UTILIZATION(population, individual) \
+	((population)->network_utilization + (size_t)(individual) * (population)->l_size)
+#define OBJECTIVES(population, individual) \
+	((population)->objectives + (size_t)(individual) * NUMBER_OF_OBJECTIVES)
+
+/* structure of a population arena: every block is contiguous and indexed by individual first */
+struct population
+{
+	int number_of_individuals;
+	int h_size;
+	int v_size;
+	int l_size;
+	/* placement of the virtual machines [individual][virtual], 0 means not placed */
+	int *genes;
+	/* utilization of Processor, Memory and Storage [individual][physical][resource] */
+	int *utilization;
+	/* utilization of the network links [individual][link] */
+	long long *network_utilization;
+	/* cost of each objective function [individual][objective] */
+	float *objectives;
+	/* 1 if the individual meets every constraint, 0 if the reparation could not make it factible [individual] */
+	int *feasible;
+	/* single allocation holding all the blocks above, NULL for a view of another arena */
+	void *arena;
+};
+
+/* function headers definitions */
+struct population * population_create(int number_of_individuals, int h_size, int v_size, int l_size);
+void population_free(struct population *population);
+void population_view(struct population *view, struct population *population, int first_individual, int number_of_individuals);
+void population_copy_individual(struct population *destination, int destination_individual, struct population *source, int source_individual);
+
+#endif
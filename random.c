@@ -0,0 +1,86 @@
+/*
+ * random.c: Virtual Machine Placement Problem - Random Number Streams
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include random number streams header */
+#include "random.h"
+
+/* splitmix64: advances a splitmix64 generator, used to expand a seed into a xoshiro256** state
+ * parameter: state of the generator
+ * returns: next value
+ */
+static unsigned long long splitmix64(unsigned long long *state)
+{
+	unsigned long long value = (*state += 0x9E3779B97F4A7C15ULL);
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+/* rotate_left: rotates a 64 bits value
+ * parameter: value
+ * parameter: number of bits, between 1 and 63
+ * returns: rotated value
+ */
+static unsigned long long rotate_left(unsigned long long value, int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+/* random_seed: starts the stream of a seed, different streams of the same seed are independent,
+ * so a stage can give each individual its own stream and get the same numbers on any thread
+ * parameter: random number stream
+ * parameter: seed
+ * parameter: identificator of the stream, for example the individual
+ * returns: nothing, it's void
+ */
+void random_seed(struct random *random, unsigned long long seed, unsigned long long stream)
+{
+	unsigned long long mixer = stream;
+	/* iterator */
+	int iterator_state;
+	mixer = seed ^ splitmix64(&mixer);
+	for (iterator_state = 0; iterator_state < 4; iterator_state++)
+	{
+		random->state[iterator_state] = splitmix64(&mixer);
+	}
+}
+
+/* random_next: next 64 bits of a stream
+ * parameter: random number stream
+ * returns: uniformly distributed 64 bits value
+ */
+unsigned long long random_next(struct random *random)
+{
+	unsigned long long *state = random->state;
+	unsigned long long result = rotate_left(state[1] * 5, 7) * 9;
+	unsigned long long shifted = state[1] << 17;
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= shifted;
+	state[3] = rotate_left(state[3], 45);
+	return result;
+}
+
+/* random_int: next integer of a stream below a bound, by multiplication instead of modulo
+ * parameter: random number stream
+ * parameter: bound, greater than 0
+ * returns: integer between 0 and bound - 1
+ */
+int random_int(struct random *random, int bound)
+{
+	return (int) (((random_next(random) >> 32) * (unsigned long long) bound) >> 32);
+}
+
+/* random_double: next real number of a stream
+ * parameter: random number stream
+ * returns: real number between 0 and 1, 1 excluded
+ */
+double random_double(struct random *random)
+{
+	return (random_next(random) >> 11) * (1.0 / 9007199254740992.0);
+}
@@ -0,0 +1,29 @@
+/*
+ * random.h: Virtual Machine Placement Problem - Random Number Streams Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+/* state of a xoshiro256** random number stream, owned by a single thread at a time */
+struct random
+{
+	unsigned long long state[4];
+};
+
+/* function headers definitions */
+void random_seed(struct random *random, unsigned long long seed, unsigned long long stream);
+unsigned long long random_next(struct random *random);
+int random_int(struct random *random, int bound);
+double random_double(struct random *random);
+
+#endif
@@ -8,238 +8,619 @@
 /* include reparation stage header */
 #include "reparation.h"
 
+/* structure of the workspace of the repairs of a thread */
+struct repair_workspace
+{
+	/* evaluation state used to move the virtual machines */
+	struct evaluation *evaluation;
+	/* free capacity index of the individual being repaired */
+	struct capacity_index *index;
+	/* virtual machines sorted by decreasing size, shared by the threads */
+	int *packing_order;
+	/* placement of the individual before the packing */
+	int *previous_genes;
+	/* physical machines using an overloaded network link, and traffic of each virtual machine through them */
+	int *crossing;
+	long long *traffic;
+	/* virtual machines sorted by that traffic */
+	int *order;
+};
+
+/* context of the repair task */
+struct repair_context
+{
+	struct population *population;
+	struct datacenter *datacenter;
+	int max_SLA;
+	int policy;
+	unsigned long long seed;
+	/* workspace of each thread */
+	struct repair_workspace *workspaces;
+};
+
 /* reparation: reparates the population
- * parameter: population matrix
- * parameter: physical machines matrix
- * parameter: virtual machines matrix
- * parameter: number of individuals
- * parameter: number of physical machines
- * parameter: number of virtual machines
- * returns: reparated population matrix
+ * parameter: population arena
+ * parameter: datacenter instance
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: policy choosing the physical machine of a migrated virtual machine: FIT_FIRST, FIT_BEST or FIT_WORST
+ * parameter: seed of the random streams of the individuals
+ * parameter: task pool repairing the individuals in parallel, NULL to repair them on the calling thread
+ * parameter: scratch arena for the workspaces, NULL to allocate them for this call
+ * returns: nothing, it's void(), the population arena is reparated in place
  */
-int** reparation(int ** population, int *** utilization, int ** H, int ** V, int number_of_individuals, int h_size, int v_size, int max_SLA, int * K, int ** network_utilization, int l_size, int ** G, int ** T)
+void reparation(struct population *population, struct datacenter *datacenter, int max_SLA, int policy, unsigned long long seed,
+	struct pool *pool, struct scratch *scratch)
 {
 	/* repairs population from not factible individuals */
-	repair_population(population, utilization, H, V, number_of_individuals, h_size, v_size, max_SLA, K, network_utilization, l_size, G, T);
-	return population;
+	repair_population(population, datacenter, max_SLA, policy, seed, pool, scratch);
 }
 
-/* repair_population: repairs population from not factible individuals
- * parameter: population matrix
- * parameter: utilization of the physical machines matrix
- * parameter: physical machines matrix
- * parameter: virtual machines matrix
- * parameter: number of individuals
- * parameter: number of physical machines
+/* repair_task: repairs the not factible individuals of a range, each one from its own random stream, and marks
+ * the feasibility of each individual of the range
+ * parameter: repair context
+ * parameter: first individual
+ * parameter: end of the range of individuals
+ * parameter: thread running the task, it selects the workspace
+ * returns: nothing, it's void
+ */
+static void repair_task(void *context, int begin, int end, int thread)
+{
+	struct population *population = ((struct repair_context *) context)->population;
+	struct datacenter *datacenter = ((struct repair_context *) context)->datacenter;
+	int max_SLA = ((struct repair_context *) context)->max_SLA;
+	/* iterators */
+	int iterator_individual;
+	/* random stream of the current individual */
+	struct random random;
+	/* iterate on individuals */
+	for (iterator_individual = begin; iterator_individual < end; iterator_individual++)
+	{
+		/* if the individual is not factible */
+		population->feasible[iterator_individual] = is_factible(population, datacenter, max_SLA, iterator_individual);
+		if (!population->feasible[iterator_individual])
+		{
+			random_seed(&random, ((struct repair_context *) context)->seed, iterator_individual);
+			repair_individual(population, datacenter, ((struct repair_context *) context)->workspaces + thread, &random, max_SLA,
+				((struct repair_context *) context)->policy, iterator_individual);
+			/* a repair can miss, when the mandatory virtual machines alone overload a link or do not fit */
+			population->feasible[iterator_individual] = is_factible(population, datacenter, max_SLA, iterator_individual);
+		}
+	}
+}
+
+/* packing_order: sorts the virtual machines by decreasing size, with a shell sort that needs no memory
+ * parameter: free capacity index, for the size of the virtual machines
+ * parameter: virtual machines requirements matrix
  * parameter: number of virtual machines
+ * parameter: array to fill with the sorted virtual machines
+ * returns: nothing, it's void
+ */
+static void packing_order(struct capacity_index *index, int **V, int v_size, int *order)
+{
+	/* iterators */
+	int iterator_virtual;
+	int iterator_position;
+	int gap;
+	int virtual;
+	float size;
+	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	{
+		order[iterator_virtual] = iterator_virtual;
+	}
+	for (gap = 1; gap < v_size / 3; gap = 3 * gap + 1);
+	for (; gap > 0; gap /= 3)
+	{
+		for (iterator_virtual = gap; iterator_virtual < v_size; iterator_virtual++)
+		{
+			virtual = order[iterator_virtual];
+			size = capacity_index_size(index, V[virtual]);
+			for (iterator_position = iterator_virtual; iterator_position >= gap &&
+				capacity_index_size(index, V[order[iterator_position - gap]]) < size; iterator_position -= gap)
+			{
+				order[iterator_position] = order[iterator_position - gap];
+			}
+			order[iterator_position] = virtual;
+		}
+	}
+}
+
+/* repair_population: repairs population from not factible individuals
+ * parameter: population arena
+ * parameter: datacenter instance
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: policy choosing the physical machine of a migrated virtual machine: FIT_FIRST, FIT_BEST or FIT_WORST
+ * parameter: seed of the random streams of the individuals
+ * parameter: task pool repairing the individuals in parallel, NULL to repair them on the calling thread
+ * parameter: scratch arena for the workspaces, NULL to allocate them for this call
  * returns: nothing, it's void()
  */
-void repair_population(int ** population, int *** utilization, int ** H, int ** V, int number_of_individuals, int h_size, int v_size, int max_SLA, int * K, int ** network_utilization, int l_size, int ** G, int ** T)
+void repair_population(struct population *population, struct datacenter *datacenter, int max_SLA, int policy, unsigned long long seed,
+	struct pool *pool, struct scratch *scratch)
+{
+	/* iterator */
+	int iterator_thread;
+	struct repair_context context = {population, datacenter, max_SLA, policy, seed, NULL};
+	struct scratch *temporary = NULL;
+	size_t mark;
+	int *order;
+	if (scratch == NULL)
+	{
+		scratch = temporary = scratch_create(0);
+	}
+	mark = scratch_mark(scratch);
+	/* workspace shared by the individuals repaired on the same thread */
+	context.workspaces = (struct repair_workspace *) scratch_alloc (scratch, pool_size(pool) * sizeof (struct repair_workspace));
+	order = (int *) scratch_alloc (scratch, (datacenter->v_size + 1) * sizeof (int));
+	for (iterator_thread = 0; iterator_thread < pool_size(pool); iterator_thread++)
+	{
+		context.workspaces[iterator_thread].evaluation = evaluation_create_scratch(datacenter, scratch);
+		context.workspaces[iterator_thread].index = capacity_index_create_scratch(datacenter, scratch);
+		context.workspaces[iterator_thread].packing_order = order;
+		context.workspaces[iterator_thread].previous_genes = (int *) scratch_alloc (scratch, (datacenter->v_size + 1) * sizeof (int));
+		context.workspaces[iterator_thread].crossing = (int *) scratch_alloc (scratch, (datacenter->h_size + 1) * sizeof (int));
+		context.workspaces[iterator_thread].traffic = (long long *) scratch_alloc (scratch, (datacenter->v_size + 1) * sizeof (long long));
+		context.workspaces[iterator_thread].order = (int *) scratch_alloc (scratch, (datacenter->v_size + 1) * sizeof (int));
+	}
+	packing_order(context.workspaces[0].index, datacenter->V, datacenter->v_size, order);
+	/* the repair cost varies a lot between individuals, single individual chunks let the threads balance it */
+	pool_run(pool, population->number_of_individuals, 1, repair_task, &context);
+	scratch_release(scratch, mark);
+	scratch_free(temporary);
+}
+
+/* is_allocated: checks the constraints of an individual on the physical machines
+ * parameter: population arena, with the utilization loaded
+ * parameter: datacenter instance
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: identificator of the individual
+ * returns: 1 if the mandatory virtual machines are placed and no physical machine is overloaded, 0 if not
+ */
+static int is_allocated(struct population *population, struct datacenter *datacenter, int max_SLA, int individual)
 {
 	/* iterators */
-	int iterator_individual = 0;
-	int iterator_virtual = 0;
-	int iterator_physical = 0;
-	int iterator_link = 0;
-	int factibility = 1;
-	/* iterate on individuals */
-	for (iterator_individual = 0; iterator_individual < number_of_individuals ; iterator_individual++)
+	int iterator_virtual;
+	int iterator_physical;
+	/* genes of the individual */
+	int *genes = GENES(population, individual);
+	/* constraint 2: Service Level Agreement (SLA) provision. Virtual machines with SLA = max_SLA have to be placed mandatorily */
+	for (iterator_virtual = 0; iterator_virtual < population->v_size; iterator_virtual++)
 	{
-		/* every individual is feasible until it's probed other thing */		
-		factibility = 1;
-		/* constraint 2: Service Level Agreement (SLA) provision. Virtual machines with SLA = max_SLA have to be placed mandatorily */
-		for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+		if (datacenter->V[iterator_virtual][3] == max_SLA && genes[iterator_virtual] == 0)
 		{
-			if (V[iterator_virtual][3] == max_SLA && population[iterator_individual][iterator_virtual] == 0)
+			return 0;
+		}
+	}
+	/* constraints 3-5: Resource capacity of physical machines. Iterate on physical machines */
+	for (iterator_physical = 0; iterator_physical < population->h_size; iterator_physical++)
+	{
+		/* if any physical machine is overloaded on any resource, the individual is not factible */
+		if (is_overloaded(datacenter->H, population, individual, iterator_physical))
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* is_factible: checks the constraints of an individual
+ * parameter: population arena, with the utilization and network utilization loaded
+ * parameter: datacenter instance
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: identificator of the individual
+ * returns: 1 if the individual is factible, 0 if not
+ */
+int is_factible(struct population *population, struct datacenter *datacenter, int max_SLA, int individual)
+{
+	/* iterator */
+	int iterator_link;
+	if (!is_allocated(population, datacenter, max_SLA, individual))
+	{
+		return 0;
+	}
+	/* constraint 6: Network link capacity. Iterate on network links */
+	for (iterator_link = 0; iterator_link < population->l_size; iterator_link++)
+	{
+		if (is_overassigned(datacenter->K, population, individual, iterator_link))
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* move_virtual: moves a virtual machine and keeps the free capacity index up to date
+ * parameter: workspace
+ * parameter: identificator of the virtual machine
+ * parameter: new physical position, from 1 to h_size, or 0 to leave the virtual machine not placed
+ * returns: nothing, it's void
+ */
+static void move_virtual(struct repair_workspace *workspace, int virtual, int physical_position)
+{
+	int old_physical_position = workspace->evaluation->genes[virtual];
+	/* move the requirements and the network traffic from the source to the destination */
+	evaluation_move_vm(workspace->evaluation, virtual, physical_position);
+	if (old_physical_position != 0)
+	{
+		capacity_index_update(workspace->index, old_physical_position - 1);
+	}
+	if (physical_position != 0)
+	{
+		capacity_index_update(workspace->index, physical_position - 1);
+	}
+}
+
+/* pack_individual: places the virtual machines of an individual again from scratch: first the mandatory ones,
+ * by best fit decreasing, then the others by decreasing size, on their previous physical machine if they still fit
+ * parameter: population arena
+ * parameter: datacenter instance
+ * parameter: workspace, attached to the individual
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: policy choosing the physical machine of the virtual machines that are not mandatory
+ * parameter: identificator of the individual
+ * returns: nothing, it's void
+ */
+static void pack_individual(struct population *population, struct datacenter *datacenter, struct repair_workspace *workspace,
+	int max_SLA, int policy, int individual)
+{
+	/* iterators */
+	int iterator_virtual;
+	int iterator_pass;
+	int virtual;
+	int candidate;
+	int **V = datacenter->V;
+	int *genes = GENES(population, individual);
+	memcpy(workspace->previous_genes, genes, datacenter->v_size * sizeof (int));
+	/* every virtual machine leaves its physical machine */
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		evaluation_move_vm(workspace->evaluation, iterator_virtual, 0);
+	}
+	capacity_index_attach(workspace->index, UTILIZATION(population, individual));
+	for (iterator_pass = 0; iterator_pass < 2; iterator_pass++)
+	{
+		for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+		{
+			virtual = workspace->packing_order[iterator_virtual];
+			/* the mandatory virtual machines in the first pass, the others in the second one */
+			if ((V[virtual][3] == max_SLA) != (iterator_pass == 0))
 			{
-				factibility = 0;
-				break;
+				continue;
+			}
+			if (iterator_pass == 1 && workspace->previous_genes[virtual] != 0 &&
+				capacity_index_fits(workspace->index, workspace->previous_genes[virtual] - 1, V[virtual]))
+			{
+				candidate = workspace->previous_genes[virtual] - 1;
+			}
+			else
+			{
+				candidate = capacity_index_find(workspace->index, V[virtual], iterator_pass == 0 ? FIT_BEST : policy, 0);
+			}
+			if (candidate >= 0)
+			{
+				move_virtual(workspace, virtual, candidate + 1);
 			}
 		}
-		/* constraints 3-5: Resource capacity of physical machines. Iterate on physical machines */
-		for (iterator_physical = 0; iterator_physical < h_size ; iterator_physical++)
+	}
+}
+
+/* heaviest_peer: finds the physical machine of the peer a virtual machine exchanges the most traffic with,
+ * among the ones the virtual machine fits in
+ * parameter: datacenter instance
+ * parameter: workspace, attached to the individual
+ * parameter: identificator of the virtual machine
+ * returns: the physical position of the peer, 0 if there is none
+ */
+static int heaviest_peer(struct datacenter *datacenter, struct repair_workspace *workspace, int virtual)
+{
+	struct traffic_matrix *T = datacenter->T;
+	int *genes = workspace->evaluation->genes;
+	/* iterator */
+	int iterator_pair;
+	int physical_position;
+	int best_position = 0;
+	traffic_t best_traffic = 0;
+	for (iterator_pair = T->row_start[virtual]; iterator_pair < T->row_start[virtual + 1]; iterator_pair++)
+	{
+		physical_position = genes[T->column[iterator_pair]];
+		if (physical_position != 0 && physical_position != genes[virtual] && T->value[iterator_pair] > best_traffic &&
+			capacity_index_fits(workspace->index, physical_position - 1, datacenter->V[virtual]))
+		{
+			best_traffic = T->value[iterator_pair];
+			best_position = physical_position;
+		}
+	}
+	for (iterator_pair = T->column_start[virtual]; iterator_pair < T->column_start[virtual + 1]; iterator_pair++)
+	{
+		physical_position = genes[T->row[iterator_pair]];
+		if (physical_position != 0 && physical_position != genes[virtual] && T->column_value[iterator_pair] > best_traffic &&
+			capacity_index_fits(workspace->index, physical_position - 1, datacenter->V[virtual]))
+		{
+			best_traffic = T->column_value[iterator_pair];
+			best_position = physical_position;
+		}
+	}
+	return best_position;
+}
+
+/* colocated_traffic: traffic a virtual machine exchanges with its peers in a physical machine
+ * parameter: datacenter instance
+ * parameter: workspace, attached to the individual
+ * parameter: identificator of the virtual machine
+ * parameter: physical position
+ * returns: the traffic with the peers placed there, that does not go through the network
+ */
+static long long colocated_traffic(struct datacenter *datacenter, struct repair_workspace *workspace, int virtual, int physical_position)
+{
+	struct traffic_matrix *T = datacenter->T;
+	int *genes = workspace->evaluation->genes;
+	/* iterator */
+	int iterator_pair;
+	long long traffic = 0;
+	for (iterator_pair = T->row_start[virtual]; iterator_pair < T->row_start[virtual + 1]; iterator_pair++)
+	{
+		if (genes[T->column[iterator_pair]] == physical_position)
+		{
+			traffic += T->value[iterator_pair];
+		}
+	}
+	for (iterator_pair = T->column_start[virtual]; iterator_pair < T->column_start[virtual + 1]; iterator_pair++)
+	{
+		if (genes[T->row[iterator_pair]] == physical_position)
+		{
+			traffic += T->column_value[iterator_pair];
+		}
+	}
+	return traffic;
+}
+
+/* overloaded_traffic: traffic of a virtual machine that goes through overloaded network links
+ * parameter: datacenter instance
+ * parameter: workspace, with the physical machines using overloaded links marked
+ * parameter: identificator of the virtual machine, placed
+ * returns: traffic exchanged with the peers in other physical machines, when one of both uses an overloaded link
+ */
+static long long overloaded_traffic(struct datacenter *datacenter, struct repair_workspace *workspace, int virtual)
+{
+	struct traffic_matrix *T = datacenter->T;
+	int *genes = workspace->evaluation->genes;
+	int physical_position = genes[virtual];
+	int physical_position_again;
+	/* iterator */
+	int iterator_pair;
+	long long traffic = 0;
+	for (iterator_pair = T->row_start[virtual]; iterator_pair < T->row_start[virtual + 1]; iterator_pair++)
+	{
+		physical_position_again = genes[T->column[iterator_pair]];
+		if (physical_position_again != 0 && physical_position_again != physical_position &&
+			(workspace->crossing[physical_position - 1] || workspace->crossing[physical_position_again - 1]))
+		{
+			traffic += T->value[iterator_pair];
+		}
+	}
+	for (iterator_pair = T->column_start[virtual]; iterator_pair < T->column_start[virtual + 1]; iterator_pair++)
+	{
+		physical_position_again = genes[T->row[iterator_pair]];
+		if (physical_position_again != 0 && physical_position_again != physical_position &&
+			(workspace->crossing[physical_position - 1] || workspace->crossing[physical_position_again - 1]))
+		{
+			traffic += T->column_value[iterator_pair];
+		}
+	}
+	return traffic;
+}
+
+/* link_candidates: sorts the virtual machines contributing to the overloaded network links by decreasing traffic
+ * through them, in the order of the workspace
+ * parameter: population arena
+ * parameter: datacenter instance
+ * parameter: workspace, attached to the individual
+ * parameter: identificator of the individual
+ * returns: the number of virtual machines sorted
+ */
+static int link_candidates(struct population *population, struct datacenter *datacenter, struct repair_workspace *workspace, int individual)
+{
+	struct network_topology *topology = datacenter->topology;
+	int *genes = GENES(population, individual);
+	long long *network_utilization = NETWORK_UTILIZATION(population, individual);
+	long long *traffic = workspace->traffic;
+	int *order = workspace->order;
+	/* iterators */
+	int iterator_physical;
+	int iterator_position;
+	int iterator_virtual;
+	int number_of_candidates = 0;
+	int gap;
+	int virtual;
+	/* the physical machines using an overloaded link */
+	for (iterator_physical = 0; iterator_physical < datacenter->h_size; iterator_physical++)
+	{
+		workspace->crossing[iterator_physical] = 0;
+		for (iterator_position = topology->link_start[iterator_physical]; iterator_position < topology->link_start[iterator_physical + 1]; iterator_position++)
 		{
-			/* if any physical machine is overloaded on any resource, the individual is not factible */
-			if (is_overloaded(H, utilization, iterator_individual, iterator_physical))
+			if (network_utilization[topology->link[iterator_position]] > datacenter->K[topology->link[iterator_position]])
 			{
-				factibility = 0;
+				workspace->crossing[iterator_physical] = 1;
 				break;
 			}
 		}
+	}
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		traffic[iterator_virtual] = genes[iterator_virtual] != 0 ? overloaded_traffic(datacenter, workspace, iterator_virtual) : 0;
+		if (traffic[iterator_virtual] > 0)
+		{
+			order[number_of_candidates++] = iterator_virtual;
+		}
+	}
+	for (gap = 1; gap < number_of_candidates / 3; gap = 3 * gap + 1);
+	for (; gap > 0; gap /= 3)
+	{
+		for (iterator_virtual = gap; iterator_virtual < number_of_candidates; iterator_virtual++)
+		{
+			virtual = order[iterator_virtual];
+			for (iterator_position = iterator_virtual; iterator_position >= gap &&
+				traffic[order[iterator_position - gap]] < traffic[virtual]; iterator_position -= gap)
+			{
+				order[iterator_position] = order[iterator_position - gap];
+			}
+			order[iterator_position] = virtual;
+		}
+	}
+	return number_of_candidates;
+}
 
-		/* if the individual is not factible */
-		if (factibility == 0)
+/* repair_links: relieves the overloaded network links of an individual whose physical machines are not overloaded.
+ * The virtual machines are scored by their traffic through overloaded links and, the heaviest first, move next to
+ * their heaviest peer if more of their traffic stays inside a physical machine there, which is checked in O(degree)
+ * first, and the move is kept only if the excess over the link capacities falls. If some link is still overloaded,
+ * the heaviest virtual machines that are not mandatory are not placed until it is relieved: the excess left after
+ * that comes from the mandatory virtual machines alone, and the individual stays not factible. The moves update
+ * the link utilization incrementally, and the physical machines are never overloaded
+ * parameter: population arena
+ * parameter: datacenter instance
+ * parameter: workspace, attached to the individual
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: identificator of the individual
+ * returns: nothing, it's void
+ */
+static void repair_links(struct population *population, struct datacenter *datacenter, struct repair_workspace *workspace,
+	int max_SLA, int individual)
+{
+	struct evaluation *evaluation = workspace->evaluation;
+	int *order = workspace->order;
+	/* iterators */
+	int iterator_position;
+	int number_of_candidates;
+	int virtual;
+	int physical_position;
+	int candidate;
+	long long link_excess;
+	/* next to the heaviest peer, the traffic between them leaves the network */
+	number_of_candidates = link_candidates(population, datacenter, workspace, individual);
+	for (iterator_position = 0; iterator_position < number_of_candidates && evaluation->link_excess > 0; iterator_position++)
+	{
+		virtual = order[iterator_position];
+		candidate = heaviest_peer(datacenter, workspace, virtual);
+		if (candidate != 0 && colocated_traffic(datacenter, workspace, virtual, candidate) >
+			colocated_traffic(datacenter, workspace, virtual, evaluation->genes[virtual]))
+		{
+			/* the traffic to the other peers can load other links, the move back always fits */
+			physical_position = evaluation->genes[virtual];
+			link_excess = evaluation->link_excess;
+			move_virtual(workspace, virtual, candidate);
+			if (evaluation->link_excess >= link_excess)
+			{
+				move_virtual(workspace, virtual, physical_position);
+			}
+		}
+	}
+	if (evaluation->link_excess <= 0)
+	{
+		return;
+	}
+	/* the rest of the overload leaves the datacenter */
+	number_of_candidates = link_candidates(population, datacenter, workspace, individual);
+	for (iterator_position = 0; iterator_position < number_of_candidates && evaluation->link_excess > 0; iterator_position++)
+	{
+		virtual = order[iterator_position];
+		if (datacenter->V[virtual][3] != max_SLA)
 		{
-			repair_individual(population, utilization, H, V, number_of_individuals, h_size, v_size, max_SLA, K, network_utilization, l_size, iterator_individual, G, T);
+			physical_position = evaluation->genes[virtual];
+			link_excess = evaluation->link_excess;
+			move_virtual(workspace, virtual, 0);
+			if (evaluation->link_excess >= link_excess)
+			{
+				move_virtual(workspace, virtual, physical_position);
+			}
 		}
 	}
 }
 
-/* repair_individual: repairs not factible individuals
- * parameter: population matrix
- * parameter: utilization of the physical machines matrix
- * parameter: physical machines matrix
- * parameter: virtual machines matrix
- * parameter: number of individuals
- * parameter: number of physical machines
- * parameter: number of virtual machines
+/* repair_individual: repairs not factible individuals. The virtual machines of overloaded physical machines migrate
+ * to a physical machine chosen by the policy among the ones they fit in, or are not placed if it is allowed. If some
+ * mandatory virtual machines are left out or overloading, the individual is packed again from scratch. Then the
+ * overloaded network links are relieved
+ * parameter: population arena
+ * parameter: datacenter instance
+ * parameter: workspace of the thread
+ * parameter: random number stream
+ * parameter: maximum SLA, virtual machines with this SLA are placed mandatorily
+ * parameter: policy choosing the physical machine of a migrated virtual machine: FIT_FIRST, FIT_BEST or FIT_WORST
  * parameter: identificator of the not factible individual to repair
  * returns: nothing, it's void()
  */
-void repair_individual(int ** population, int *** utilization, int ** H, int ** V, int number_of_individuals, int h_size, int v_size, int max_SLA, int * K, int ** network_utilization, int l_size, int individual, int ** G, int ** T)
+void repair_individual(struct population *population, struct datacenter *datacenter, struct repair_workspace *workspace,
+	struct random *random, int max_SLA, int policy, int individual)
 {
 	int iterator_virtual = 0;
-	int iterator_virtual_again=0;
-	int iterator_physical = 0;	
-	int iterator_link = 0;
-	/* every individual is not feasible until it's probed other thing */		
-	int factibility = 0;
 	/* id of a candidate physical machine for migration */
 	int candidate = 0;
-	/* a migration flag for overloaded physical machines indicating that a virtual machine was or not migrated yet */
-	int migration = 0;
+	/* rows of the individual to repair */
+	int *genes = GENES(population, individual);
+	int **H = datacenter->H;
+	int **V = datacenter->V;
+	int h_size = datacenter->h_size;
+	/* migrations update the utilization, network utilization and costs of the individual in place */
+	evaluation_attach(workspace->evaluation, population, individual);
+	capacity_index_attach(workspace->index, UTILIZATION(population, individual));
 	/* iterate on each virtual machine to search for overloaded physical machines */
-	for (iterator_virtual = 0; iterator_virtual < v_size; iterator_virtual++)
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
 	{
-		/* if the virtual machine was placed */
-		if (population[individual][iterator_virtual] != 0)
+		/* verify if the virtual machine was placed in a physical machine overloaded in any physical resource */
+		if (genes[iterator_virtual] != 0 && is_overloaded(H, population, individual, (genes[iterator_virtual]-1)))
 		{
-			migration = 0;
-			/* verify is the physical machine assigned is overloaded in any physical resource */
-			if (is_overloaded(H, utilization, individual, (population[individual][iterator_virtual]-1)))
+			/* we search for a correct candidate for VM "migration" (it is not really a migration, only a physical machine change),
+			the first fit starts from a random physical machine to spread the migrations */
+			candidate = capacity_index_find(workspace->index, V[iterator_virtual], policy, random_int(random, h_size));
+			if (candidate >= 0)
+			{
+				/* virtual machine correctly "migrated" */
+				move_virtual(workspace, iterator_virtual, candidate + 1);
+			}
+			else if (V[iterator_virtual][3] != max_SLA)
 			{
-				/* we search for a correct candidate for VM "migration" (it is not really a migration, only a physical machine change) */
-				candidate = rand() % h_size;
-				for (iterator_physical=0; iterator_physical < h_size; iterator_physical++)
-				{				
-					/* if the candidate can assume the resource requested */
-					if (utilization[individual][candidate][0] + V[iterator_virtual][0] <= H[candidate][0] &&
-	   			   	 	utilization[individual][candidate][1] + V[iterator_virtual][1] <= H[candidate][1] && 
-						utilization[individual][candidate][2] + V[iterator_virtual][2] <= H[candidate][2])
-					{
-						/* delete requirements from physical machine migration source */
-						utilization[individual][population[individual][iterator_virtual]-1][0] -= V[iterator_virtual][0];
-						utilization[individual][population[individual][iterator_virtual]-1][1] -= V[iterator_virtual][1];
-						utilization[individual][population[individual][iterator_virtual]-1][2] -= V[iterator_virtual][2];
-						/* delete requirements from network links related to physical machine migration source */
-						for (iterator_virtual_again=0; iterator_virtual_again < v_size; iterator_virtual_again++)
-						{
-							/* consider only traffic between virtual machines in different physical machines */
-							if (population[individual][iterator_virtual] != population[individual][iterator_virtual_again] && population[individual][iterator_virtual_again] != 0)
-							{
-								/* for each network link */
-								for (iterator_link=0; iterator_link < l_size; iterator_link++)
-								{
-									/* add the corresponding traffic for each used link */
-									if (G[population[individual][iterator_virtual]-1][iterator_link] !=0 || 
-									G[population[individual][iterator_virtual_again]-1][iterator_link] !=0)
-									{	
-										if(T[iterator_virtual][iterator_virtual_again]!=0)
-										{
-											network_utilization[individual][iterator_link] -= T[iterator_virtual][iterator_virtual_again];
-										}
-									}
-								}
-							}
-						}
-						/* add requirements from physical machine migration destination */
-						utilization[individual][candidate][0] += V[iterator_virtual][0];
-						utilization[individual][candidate][1] += V[iterator_virtual][1];
-						utilization[individual][candidate][2] += V[iterator_virtual][2];
-						/* refresh the population */
-						population[individual][iterator_virtual] = candidate + 1;
-						/* add requirements from network links related to physical machine migration destination */
-						for (iterator_virtual_again=0; iterator_virtual_again < v_size; iterator_virtual_again++)
-						{
-							/* consider only traffic between virtual machines in different physical machines */
-							if (population[individual][iterator_virtual] != population[individual][iterator_virtual_again] && population[individual][iterator_virtual_again] != 0)
-							{
-								/* for each network link */
-								for (iterator_link=0; iterator_link < l_size; iterator_link++)
-								{
-									/* add the corresponding traffic for each used link */
-									if (G[population[individual][iterator_virtual]-1][iterator_link] !=0 || 
-									G[population[individual][iterator_virtual_again]-1][iterator_link] !=0)
-									{
-										if(T[iterator_virtual][iterator_virtual_again]!=0)
-										{
-											network_utilization[individual][iterator_link] += T[iterator_virtual][iterator_virtual_again];
-										}
-									}
-								}
-							}
-						}
-						/* virtual machine correctly "migrated" */
-						migration = 1;
-						break;
-						if (candidate < h_size)
-						{
-							candidate++;
-						}
-						else
-						{
-							candidate = 0;
-						}
-					}
-				}
-				if (!migration)
-				{
-					if (V[iterator_virtual][3]!=max_SLA)
-					{
-						/* delete requirements from physical machine migration source */
-						utilization[individual][population[individual][iterator_virtual]-1][0] -= V[iterator_virtual][0];
-						utilization[individual][population[individual][iterator_virtual]-1][1] -= V[iterator_virtual][1];
-						utilization[individual][population[individual][iterator_virtual]-1][2] -= V[iterator_virtual][2];
-						/* delete requirements from network links related to physical machine migration source */
-						for (iterator_virtual_again=0; iterator_virtual_again < v_size; iterator_virtual_again++)
-						{
-							/* consider only traffic between virtual machines in different physical machines */
-							if (population[individual][iterator_virtual] != population[individual][iterator_virtual_again] && population[individual][iterator_virtual_again] != 0)
-							{
-								/* for each network link */
-								for (iterator_link=0; iterator_link < l_size; iterator_link++)
-								{
-									/* add the corresponding traffic for each used link */
-									if (G[population[individual][iterator_virtual]-1][iterator_link] !=0 || 
-									G[population[individual][iterator_virtual_again]-1][iterator_link] !=0)
-									{						
-										if(T[iterator_virtual][iterator_virtual_again]!=0)
-										{
-											network_utilization[individual][iterator_link] -= T[iterator_virtual][iterator_virtual_again];
-										}
-									}
-								}
-							}
-						}
-						/* refresh the population */
-						population[individual][iterator_virtual] = 0;
-						/* virtual machine correctly "deleted" */
-						migration = 1;
-						break;
-					}
-				}
-				if(!migration)
-				{
-					break;
-				}
+				/* virtual machine correctly "deleted" */
+				move_virtual(workspace, iterator_virtual, 0);
 			}
 		}
 	}
+	/* constraint 2: the mandatory virtual machines that are not placed */
+	for (iterator_virtual = 0; iterator_virtual < datacenter->v_size; iterator_virtual++)
+	{
+		if (genes[iterator_virtual] == 0 && V[iterator_virtual][3] == max_SLA)
+		{
+			candidate = capacity_index_find(workspace->index, V[iterator_virtual], policy, random_int(random, h_size));
+			if (candidate >= 0)
+			{
+				move_virtual(workspace, iterator_virtual, candidate + 1);
+			}
+		}
+	}
+	if (!is_allocated(population, datacenter, max_SLA, individual))
+	{
+		pack_individual(population, datacenter, workspace, max_SLA, policy, individual);
+	}
+	/* constraint 6: the network links, once the physical machines are not overloaded */
+	if (workspace->evaluation->link_excess > 0)
+	{
+		repair_links(population, datacenter, workspace, max_SLA, individual);
+	}
 }
 
 /* is_overloaded: verificates if a physical machine is overloaded
  * parameter: physical machine resources matrix
- * parameter: utilization of the physical machines matrix
+ * parameter: population arena
  * parameter: identificator of the individual
  * parameter: identificator of the physical machine
  * returns: 1 if yes, 0 if no
  */
-int is_overloaded(int ** H, int *** utilization, int individual, int physical)
+int is_overloaded(int ** H, struct population *population, int individual, int physical)
 {
 	/* If the use of the VM exceeds the capacity of the physical machine return 1, otherwise return 0 */
-	if ((utilization[individual][physical][0] > H[physical][0]) 
-	||  (utilization[individual][physical][1] > H[physical][1])
-	||  (utilization[individual][physical][2] > H[physical][2]))
+	int *utilization = UTILIZATION(population, individual) + physical * NUMBER_OF_RESOURCES;
+	if ((utilization[0] > H[physical][0]) 
+	||  (utilization[1] > H[physical][1])
+	||  (utilization[2] > H[physical][2]))
 	{
 		return 1;
 	}
@@ -248,15 +629,15 @@ int is_overloaded(int ** H, int *** utilization, int individual, int physical)
 
 /* is_overassigned: verificates if a network link is overassigned
  * parameter: network link capacities array
- * parameter: utilization of the network links matrix
+ * parameter: population arena
  * parameter: identificator of the individual
  * parameter: identificator of the link
  * returns: 1 if yes, 0 if no
  */
-int is_overassigned(int *K, int **network_utilization, int individual, int link)
+int is_overassigned(int *K, struct population *population, int individual, int link)
 {
 	/* If the use of the VM exceeds the capacity of the physical machine return 1, otherwise return 0 */
-	if (network_utilization[individual][link] > K[link])
+	if (NETWORK_UTILIZATION(population, individual)[link] > K[link])
 	{
 		return 1;
 	}
@@ -11,10 +11,24 @@
 #include <stdlib.h>
 #include <math.h>
 #include <time.h>
+/* include population arena header */
+#include "population.h"
+#include "datacenter.h"
+#include "evaluation.h"
+#include "pool.h"
+#include "random.h"
+#include "capacity.h"
+
+/* workspace of the repairs of a thread, see reparation.c */
+struct repair_workspace;
 
 /* function headers definitions */
-int** reparation(int ** population, int *** utilization, int ** H, int ** V, int number_of_individuals, int h_size, int v_size, int max_SLA, int * K, int ** network_utilization, int l_size, int ** G, int ** T);
-void repair_population(int ** population, int *** utilization, int ** H, int ** V, int number_of_individuals, int h_size, int v_size, int max_SLA, int * K, int ** network_utilization, int l_size, int ** G, int ** T);
-void repair_individual(int ** population, int *** utilization, int ** H, int ** V, int number_of_individuals, int h_size, int v_size, int max_SLA, int * K, int ** network_utilization, int l_size, int individual, int ** G, int ** T);
-int is_overloaded(int **H, int ***utilization, int individual, int physical);
-int is_overassigned(int *K, int **network_utilization, int individual, int link);
+void reparation(struct population *population, struct datacenter *datacenter, int max_SLA, int policy, unsigned long long seed,
+	struct pool *pool, struct scratch *scratch);
+void repair_population(struct population *population, struct datacenter *datacenter, int max_SLA, int policy, unsigned long long seed,
+	struct pool *pool, struct scratch *scratch);
+void repair_individual(struct population *population, struct datacenter *datacenter, struct repair_workspace *workspace,
+	struct random *random, int max_SLA, int policy, int individual);
+int is_factible(struct population *population, struct datacenter *datacenter, int max_SLA, int individual);
+int is_overloaded(int **H, struct population *population, int individual, int physical);
+int is_overassigned(int *K, struct population *population, int individual, int link);
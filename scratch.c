@@ -0,0 +1,154 @@
+/*
+ * scratch.c: Virtual Machine Placement Problem - Generation Scratch Arena
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include generation scratch arena header */
+#include "scratch.h"
+
+/* scratch_aligned: rounds a block size up to the arena alignment
+ * parameter: size of the block in bytes
+ * returns: aligned size of the block in bytes
+ */
+static size_t scratch_aligned(size_t size)
+{
+	return (size + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT;
+}
+
+/* scratch_reserve: reserves the single block of a scratch arena
+ * parameter: scratch arena
+ * parameter: size of the block in bytes
+ * returns: nothing, it's void
+ */
+static void scratch_reserve(struct scratch *scratch, size_t size)
+{
+	void *block = NULL;
+	if (size > 0 && posix_memalign(&block, ARENA_ALIGNMENT, size) != 0)
+	{
+		printf("[ERROR] not enough memory for a scratch arena of %lu bytes\n", (unsigned long) size);
+		exit(1);
+	}
+	scratch->block = (char *) block;
+	scratch->size = size;
+}
+
+/* scratch_create: creates a scratch arena
+ * parameter: initial size of the single block in bytes, it may be 0 and grow on the resets
+ * returns: scratch arena
+ */
+struct scratch * scratch_create(size_t size)
+{
+	struct scratch *scratch = (struct scratch *) malloc (sizeof (struct scratch));
+	scratch_reserve(scratch, scratch_aligned(size));
+	scratch->used = 0;
+	scratch->overflow_size = 8;
+	scratch->overflow = (void **) malloc (scratch->overflow_size * sizeof (void *));
+	scratch->number_of_overflows = 0;
+	scratch->overflow_used = 0;
+	scratch->peak = 0;
+	return scratch;
+}
+
+/* scratch_free: releases a scratch arena and all its blocks
+ * parameter: scratch arena
+ * returns: nothing, it's void
+ */
+void scratch_free(struct scratch *scratch)
+{
+	/* iterator */
+	int iterator_overflow;
+	if (scratch != NULL)
+	{
+		for (iterator_overflow = 0; iterator_overflow < scratch->number_of_overflows; iterator_overflow++)
+		{
+			free(scratch->overflow[iterator_overflow]);
+		}
+		free(scratch->overflow);
+		free(scratch->block);
+		free(scratch);
+	}
+}
+
+/* scratch_alloc: takes a temporary block from a scratch arena, it is not thread safe, so the blocks used by the
+ * tasks of a pool are taken before running them
+ * parameter: scratch arena
+ * parameter: size of the block in bytes
+ * returns: block aligned to ARENA_ALIGNMENT, valid until the release of a previous mark or the next reset
+ */
+void * scratch_alloc(struct scratch *scratch, size_t size)
+{
+	void *block;
+	size = scratch_aligned(size > 0 ? size : 1);
+	if (scratch->used + size <= scratch->size)
+	{
+		block = scratch->block + scratch->used;
+		scratch->used += size;
+	}
+	else
+	{
+		if (posix_memalign(&block, ARENA_ALIGNMENT, size) != 0)
+		{
+			printf("[ERROR] not enough memory for a scratch block of %lu bytes\n", (unsigned long) size);
+			exit(1);
+		}
+		if (scratch->number_of_overflows == scratch->overflow_size)
+		{
+			scratch->overflow_size *= 2;
+			scratch->overflow = (void **) realloc (scratch->overflow, scratch->overflow_size * sizeof (void *));
+		}
+		scratch->overflow[scratch->number_of_overflows++] = block;
+		scratch->overflow_used += size;
+	}
+	if (scratch->used + scratch->overflow_used > scratch->peak)
+	{
+		scratch->peak = scratch->used + scratch->overflow_used;
+	}
+	return block;
+}
+
+/* scratch_mark: position of a scratch arena, to release the blocks taken after it
+ * parameter: scratch arena
+ * returns: mark
+ */
+size_t scratch_mark(struct scratch *scratch)
+{
+	return scratch->used;
+}
+
+/* scratch_release: gives back the blocks taken from the single block after a mark, the blocks allocated apart
+ * are kept until the next reset
+ * parameter: scratch arena
+ * parameter: mark
+ * returns: nothing, it's void
+ */
+void scratch_release(struct scratch *scratch, size_t mark)
+{
+	if (mark < scratch->used)
+	{
+		scratch->used = mark;
+	}
+}
+
+/* scratch_reset: gives back every block of a scratch arena. If some blocks did not fit, the single block grows to
+ * the peak seen so they fit from now on
+ * parameter: scratch arena
+ * returns: nothing, it's void
+ */
+void scratch_reset(struct scratch *scratch)
+{
+	/* iterator */
+	int iterator_overflow;
+	for (iterator_overflow = 0; iterator_overflow < scratch->number_of_overflows; iterator_overflow++)
+	{
+		free(scratch->overflow[iterator_overflow]);
+	}
+	scratch->number_of_overflows = 0;
+	scratch->overflow_used = 0;
+	scratch->used = 0;
+	if (scratch->peak > scratch->size)
+	{
+		free(scratch->block);
+		scratch_reserve(scratch, scratch->peak);
+	}
+}
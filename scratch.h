@@ -0,0 +1,44 @@
+/*
+ * scratch.h: Virtual Machine Placement Problem - Generation Scratch Arena Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef SCRATCH_H
+#define SCRATCH_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include population arena header, for the alignment of the blocks */
+#include "population.h"
+
+/* structure of a scratch arena: temporary blocks are bumped out of a single block, and everything is released
+ * at once by scratch_reset. Blocks that do not fit are allocated apart until the next reset, which grows the
+ * single block to the peak seen, so a steady loop stops allocating after its first iteration */
+struct scratch
+{
+	char *block;
+	size_t size;
+	size_t used;
+	/* blocks that did not fit in the single block */
+	void **overflow;
+	int number_of_overflows;
+	int overflow_size;
+	size_t overflow_used;
+	/* most bytes in use at once since the creation */
+	size_t peak;
+};
+
+/* function headers definitions */
+struct scratch * scratch_create(size_t size);
+void scratch_free(struct scratch *scratch);
+void * scratch_alloc(struct scratch *scratch, size_t size);
+size_t scratch_mark(struct scratch *scratch);
+void scratch_release(struct scratch *scratch, size_t mark);
+void scratch_reset(struct scratch *scratch);
+
+#endif
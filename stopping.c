@@ -0,0 +1,155 @@
+/*
+ * stopping.c: Virtual Machine Placement Problem - Stopping Criteria
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include stopping criteria header */
+#include "stopping.h"
+
+/* stopping_start: starts the clock of a run
+ * parameter: stopping criteria
+ * parameter: configuration of the run, holding the budgets
+ * returns: nothing, it's void
+ */
+void stopping_start(struct stopping *stopping, struct configuration *configuration)
+{
+	stopping->configuration = configuration;
+	clock_gettime(CLOCK_MONOTONIC, &stopping->start);
+	stopping->previous = 0.0;
+	stopping->longest_generation = 0.0;
+	stopping->normalized = 0;
+	stopping->hypervolume = 0.0;
+	stopping->stagnant_generations = 0;
+}
+
+/* stopping_elapsed: wall clock time since the start of the run
+ * parameter: stopping criteria
+ * returns: elapsed milliseconds
+ */
+double stopping_elapsed(struct stopping *stopping)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - stopping->start.tv_sec) * 1000.0 + (now.tv_nsec - stopping->start.tv_nsec) / 1000000.0;
+}
+
+/* archive_hypervolume: hypervolume of the archive, normalized by the bounds of the first archive seen
+ * so the values of different generations are comparable. It is sampled with the same samples in a fixed box,
+ * so an unchanged archive keeps the same value and an archive that only improves never loses volume
+ * parameter: stopping criteria
+ * parameter: archive
+ * parameter: scratch arena for the normalized keys, so the check of each generation allocates nothing
+ * returns: hypervolume of the archive
+ */
+double archive_hypervolume(struct stopping *stopping, struct archive *archive, struct scratch *scratch)
+{
+	/* iterators */
+	int iterator_member;
+	int iterator_objective;
+	float minimum;
+	float maximum;
+	float lower[NUMBER_OF_OBJECTIVES];
+	float reference[NUMBER_OF_OBJECTIVES];
+	float *keys;
+	unsigned short state[3] = {0x330E, 0xABCD, 0x1234};
+	struct pareto_element *element;
+	double volume;
+	size_t mark;
+	/* an empty archive, when no factible placement was found yet, dominates nothing and fixes no normalization */
+	if (archive->size == 0)
+	{
+		return 0.0;
+	}
+	if (!stopping->normalized)
+	{
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			minimum = INFINITY;
+			maximum = -INFINITY;
+			for (element = archive->head; element != NULL; element = element->next)
+			{
+				minimum = fminf(minimum, element->key[iterator_objective]);
+				maximum = fmaxf(maximum, element->key[iterator_objective]);
+			}
+			stopping->offset[iterator_objective] = minimum;
+			stopping->scale[iterator_objective] = maximum > minimum ? maximum - minimum : 1.0f;
+		}
+		stopping->normalized = 1;
+	}
+	mark = scratch_mark(scratch);
+	keys = (float *) scratch_alloc (scratch, ((size_t) archive->size * NUMBER_OF_OBJECTIVES + 1) * sizeof (float));
+	for (element = archive->head, iterator_member = 0; element != NULL; element = element->next, iterator_member++)
+	{
+		for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+		{
+			keys[iterator_member * NUMBER_OF_OBJECTIVES + iterator_objective] =
+				(element->key[iterator_objective] - stopping->offset[iterator_objective]) / stopping->scale[iterator_objective];
+		}
+	}
+	for (iterator_objective = 0; iterator_objective < NUMBER_OF_OBJECTIVES; iterator_objective++)
+	{
+		lower[iterator_objective] = STOPPING_LOWER;
+		reference[iterator_objective] = STOPPING_REFERENCE;
+	}
+	volume = hypervolume_monte_carlo(keys, archive->size, lower, reference, HV_SAMPLES, state);
+	scratch_release(scratch, mark);
+	return volume;
+}
+
+/* stopping_check: checks the budgets at the end of a generation. The deadline also stops the run when
+ * the longest generation so far would not fit before it, so the front is ready in time
+ * parameter: stopping criteria
+ * parameter: number of finished generations
+ * parameter: number of evaluated individuals
+ * parameter: archive of the known Pareto set
+ * parameter: ideal and nadir bounds of the objective functions of the instance
+ * parameter: scratch arena for the hypervolume of the stagnation check
+ * returns: STOP_CONTINUE, or the reason to stop
+ */
+int stopping_check(struct stopping *stopping, int generation, long long evaluations, struct archive *archive,
+	const struct objective_bounds *bounds, struct scratch *scratch)
+{
+	struct configuration *configuration = stopping->configuration;
+	double elapsed = stopping_elapsed(stopping);
+	double volume;
+	if (generation > 0 && elapsed - stopping->previous > stopping->longest_generation)
+	{
+		stopping->longest_generation = elapsed - stopping->previous;
+	}
+	stopping->previous = elapsed;
+	if (configuration->number_of_generations > 0 && generation >= configuration->number_of_generations)
+	{
+		return STOP_GENERATIONS;
+	}
+	if (configuration->deadline > 0.0 && elapsed + stopping->longest_generation >= configuration->deadline)
+	{
+		return STOP_DEADLINE;
+	}
+	if (configuration->max_evaluations > 0 && evaluations + configuration->number_of_individuals > configuration->max_evaluations)
+	{
+		return STOP_EVALUATIONS;
+	}
+	if (configuration->ideal_gap > 0.0 && objective_bounds_gap(bounds, archive) <= configuration->ideal_gap)
+	{
+		return STOP_IDEAL;
+	}
+	if (configuration->stagnation_generations > 0)
+	{
+		volume = archive_hypervolume(stopping, archive, scratch);
+		if (generation > 0 && volume - stopping->hypervolume <= configuration->stagnation_tolerance * fabs(stopping->hypervolume))
+		{
+			stopping->stagnant_generations++;
+		}
+		else
+		{
+			stopping->stagnant_generations = 0;
+		}
+		stopping->hypervolume = volume;
+		if (stopping->stagnant_generations >= configuration->stagnation_generations)
+		{
+			return STOP_STAGNATION;
+		}
+	}
+	return STOP_CONTINUE;
+}
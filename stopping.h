@@ -0,0 +1,54 @@
+/*
+ * stopping.h: Virtual Machine Placement Problem - Stopping Criteria Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef STOPPING_H
+#define STOPPING_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "config.h"
+#include "archive.h"
+#include "indicators.h"
+#include "bounds.h"
+/* definitions, the reason to stop */
+#define STOP_CONTINUE 0
+#define STOP_GENERATIONS 1
+#define STOP_DEADLINE 2
+#define STOP_EVALUATIONS 3
+#define STOP_STAGNATION 4
+#define STOP_IDEAL 5
+#define STOPPING_LOWER -1.0f
+#define STOPPING_REFERENCE 1.1f
+
+/* structure of the stopping criteria of a run */
+struct stopping
+{
+	struct configuration *configuration;
+	/* start of the run and end of the previous generation, and the longest generation so far, in milliseconds */
+	struct timespec start;
+	double previous;
+	double longest_generation;
+	/* normalization of the hypervolume of the archive, fixed by the first archive seen */
+	int normalized;
+	float offset[NUMBER_OF_OBJECTIVES];
+	float scale[NUMBER_OF_OBJECTIVES];
+	double hypervolume;
+	int stagnant_generations;
+};
+
+/* function headers definitions */
+void stopping_start(struct stopping *stopping, struct configuration *configuration);
+double stopping_elapsed(struct stopping *stopping);
+double archive_hypervolume(struct stopping *stopping, struct archive *archive, struct scratch *scratch);
+int stopping_check(struct stopping *stopping, int generation, long long evaluations, struct archive *archive,
+	const struct objective_bounds *bounds, struct scratch *scratch);
+
+#endif
@@ -11,14 +11,19 @@
 #include <stdlib.h>
 #include <math.h>
 #include <time.h>
+/* include population arena header */
+#include "population.h"
+#include "random.h"
+#include "pool.h"
+#include "scratch.h"
 
 /* function headers definitions */
-int *non_dominated_sorting(float ** solutions, int number_of_individuals);
-int is_dominated(float ** solutions, int a, int b);
-int selection(int *fronts, int number_of_individuals, float percent);
-int** crossover(int **population, int position_parent1, int position_parent2, int v_size);
-int ** mutation(int **population, int **V, int number_of_individuals, int h_size, int v_size);
-int ** population_evolution(int **P, int **Q, float **objectives_functions_P, float **objectives_functions_Q, int *fronts_P, int number_of_individuals, int v_size);
+int *non_dominated_sorting(float * solutions, int number_of_individuals);
+int is_dominated(float * solutions, int a, int b);
+int selection(int *fronts, int number_of_individuals, float percent, struct random *random);
+void crossover(struct population *population, int position_parent1, int position_parent2);
+void mutation(struct population *population, int **V, unsigned long long seed, struct pool *pool);
+void population_evolution(struct population *P, struct population *PQ, int *fronts_P, struct scratch *scratch);
 long double pareto_size();
 void update_pareto_set(int **P, float **objectives_functions_P, int *fronts_P, int number_of_individuals, int v_size);
 
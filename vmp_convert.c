@@ -0,0 +1,44 @@
+/*
+ * vmp_convert.c: Virtual Machine Placement Problem - Datacenter Instance Converter
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "datacenter.h"
+#include "loader.h"
+#include "vmpb.h"
+
+/* main: converts a datacenter infrastructure file to a binary instance file, loaded by imavmp without parsing
+ * parameter: path to the datacenter infrastructure file
+ * parameter: path to the binary instance file
+ * returns: exit state
+ */
+int main (int argc, char *argv[])
+{
+	struct datacenter datacenter;
+	if (argc != 3)
+	{
+		printf("[ERROR] usage: %s datacenter_file.vmp binary_file.vmpb\n", argv[0]);
+		return 1;
+	}
+	if (load_datacenter(argv[1], &datacenter) != 0)
+	{
+		return 1;
+	}
+	if (vmpb_write(argv[2], &datacenter) != 0)
+	{
+		datacenter_free(&datacenter);
+		return 1;
+	}
+	printf("%s: H=%d, V=%d, L=%d, %d pairs of virtual machines with traffic\n",
+		argv[2], datacenter.h_size, datacenter.v_size, datacenter.l_size, datacenter.T->number_of_pairs);
+	datacenter_free(&datacenter);
+	return 0;
+}
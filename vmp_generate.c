@@ -0,0 +1,163 @@
+/*
+ * vmp_generate.c: Virtual Machine Placement Problem - Synthetic Datacenter Instance Generator Tool
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "datacenter.h"
+#include "generator.h"
+#include "loader.h"
+#include "vmpb.h"
+
+/* usage: prints the command line usage
+ * parameter: name of the program
+ * returns: nothing, it's void
+ */
+static void usage(const char *program)
+{
+	printf("[ERROR] usage: %s h_size v_size output_file [--key value ...]\n", program);
+	printf("output: a .vmpb file is written as a binary instance file, any other one as a datacenter infrastructure file\n");
+	printf("keys: seed, peers (average virtual machines each one exchanges traffic with), max-traffic (of a pair, up to %d),\n",
+		MAX_TRAFFIC / 2);
+	printf("      group (virtual machines of an application, the peers are drawn inside it, 0 for the whole datacenter),\n");
+	printf("      topology (flat, rack or pod), rack (physical machines of a rack), pod (racks of a pod),\n");
+	printf("      link-capacity (of an uplink), mandatory (fraction of the virtual machines with the maximum SLA)\n");
+}
+
+/* set_option: sets an option of the instance
+ * parameter: options
+ * parameter: key
+ * parameter: value
+ * returns: 0 if the key is known and the value is valid, -1 otherwise
+ */
+static int set_option(struct generator_options *options, const char *key, const char *value)
+{
+	char *end;
+	double real = strtod(value, &end);
+	if (*value == '\0')
+	{
+		return -1;
+	}
+	if (strcmp(key, "topology") == 0)
+	{
+		if (strcmp(value, "flat") == 0)
+		{
+			options->topology = TOPOLOGY_FLAT;
+		}
+		else if (strcmp(value, "rack") == 0)
+		{
+			options->topology = TOPOLOGY_RACK;
+		}
+		else if (strcmp(value, "pod") == 0)
+		{
+			options->topology = TOPOLOGY_POD;
+		}
+		else
+		{
+			return -1;
+		}
+		return 0;
+	}
+	if (*end != '\0' || real < 0.0)
+	{
+		return -1;
+	}
+	if (strcmp(key, "seed") == 0)
+	{
+		options->seed = strtoull(value, NULL, 10);
+	}
+	else if (strcmp(key, "peers") == 0 && real < options->v_size)
+	{
+		options->peers = real;
+	}
+	else if (strcmp(key, "max-traffic") == 0 && real >= 1.0 && real <= MAX_TRAFFIC / 2)
+	{
+		options->max_traffic = (int) real;
+	}
+	else if (strcmp(key, "group") == 0 && real <= INT_MAX)
+	{
+		options->group_size = (int) real;
+	}
+	else if (strcmp(key, "rack") == 0 && real >= 1.0 && real <= 1024)
+	{
+		options->rack_size = (int) real;
+	}
+	else if (strcmp(key, "pod") == 0 && real >= 1.0 && real <= 1024)
+	{
+		options->pod_size = (int) real;
+	}
+	else if (strcmp(key, "link-capacity") == 0 && real >= 1.0 && real <= 1000000000)
+	{
+		options->link_capacity = (int) real;
+	}
+	else if (strcmp(key, "mandatory") == 0 && real <= 1.0)
+	{
+		options->mandatory = real;
+	}
+	else
+	{
+		return -1;
+	}
+	return 0;
+}
+
+/* main: generates a synthetic datacenter instance
+ * parameter: number of physical machines
+ * parameter: number of virtual machines
+ * parameter: path to the output file
+ * parameter: --key value options, see usage()
+ * returns: exit state
+ */
+int main (int argc, char *argv[])
+{
+	struct generator_options options;
+	struct datacenter datacenter;
+	struct timespec start;
+	struct timespec end;
+	/* iterator */
+	int iterator_argument;
+	size_t length;
+	int result;
+	if (argc < 4 || atoi(argv[1]) <= 0 || atoi(argv[2]) <= 0 || argc % 2 != 0)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+	generator_defaults(&options, atoi(argv[1]), atoi(argv[2]));
+	for (iterator_argument = 4; iterator_argument < argc; iterator_argument += 2)
+	{
+		if (strncmp(argv[iterator_argument], "--", 2) != 0 || set_option(&options, argv[iterator_argument] + 2, argv[iterator_argument + 1]) != 0)
+		{
+			printf("[ERROR] invalid option %s %s\n", argv[iterator_argument], argv[iterator_argument + 1]);
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	generator_create(&options, &datacenter);
+	length = strlen(argv[3]);
+	if (length > 5 && strcmp(argv[3] + length - 5, ".vmpb") == 0)
+	{
+		result = vmpb_write(argv[3], &datacenter);
+	}
+	else
+	{
+		result = generator_write(argv[3], &datacenter);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	if (result == 0)
+	{
+		printf("%s: H=%d, V=%d, L=%d, %d pairs of virtual machines with traffic, %.3f s\n", argv[3], datacenter.h_size,
+			datacenter.v_size, datacenter.l_size, datacenter.T->number_of_pairs,
+			(end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+	}
+	datacenter_free(&datacenter);
+	return result == 0 ? 0 : 1;
+}
@@ -0,0 +1,336 @@
+/*
+ * vmpb.c: Virtual Machine Placement Problem - Binary Datacenter Instance
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+/* include binary datacenter instance header */
+#include "vmpb.h"
+/* include system libraries for the memory mapping */
+#include <sys/mman.h>
+
+/* table_sizes: bytes of each table of an instance, as given by the sizes in the header
+ * parameter: header with the sizes of the instance
+ * returns: nothing, it's void, the sizes are filled in the header
+ */
+static void table_sizes(struct vmpb_header *header)
+{
+	unsigned long long h_size = (unsigned long long) header->h_size;
+	unsigned long long v_size = (unsigned long long) header->v_size;
+	unsigned long long number_of_pairs = (unsigned long long) header->number_of_pairs;
+	header->size[VMPB_PHYSICAL] = h_size * 4 * sizeof (int);
+	header->size[VMPB_VIRTUAL] = v_size * 5 * sizeof (int);
+	header->size[VMPB_ROW_START] = (v_size + 1) * sizeof (int);
+	header->size[VMPB_COLUMN] = number_of_pairs * sizeof (int);
+	header->size[VMPB_VALUE] = number_of_pairs * sizeof (traffic_t);
+	header->size[VMPB_COLUMN_START] = (v_size + 1) * sizeof (int);
+	header->size[VMPB_ROW] = number_of_pairs * sizeof (int);
+	header->size[VMPB_COLUMN_VALUE] = number_of_pairs * sizeof (traffic_t);
+	header->size[VMPB_LINK_START] = (h_size + 1) * sizeof (int);
+	header->size[VMPB_LINK] = (unsigned long long) header->number_of_links * sizeof (int);
+	header->size[VMPB_SHARED_START] = (h_size + 1) * sizeof (int);
+	header->size[VMPB_SHARED_PHYSICAL] = (unsigned long long) header->number_of_shared * sizeof (int);
+	header->size[VMPB_K] = (unsigned long long) header->l_size * sizeof (int);
+	header->size[VMPB_QOS] = v_size * sizeof (float);
+	header->size[VMPB_POWER_IDLE] = h_size * sizeof (double);
+	header->size[VMPB_POWER_DYNAMIC] = h_size * sizeof (double);
+}
+
+/* write_padding: writes zeros up to the next multiple of VMPB_ALIGNMENT
+ * parameter: binary instance file
+ * parameter: bytes written so far
+ * returns: bytes written, padding included
+ */
+static unsigned long long write_padding(FILE *binary_file, unsigned long long written)
+{
+	static const char zeros[VMPB_ALIGNMENT] = {0};
+	unsigned long long padding = (VMPB_ALIGNMENT - written % VMPB_ALIGNMENT) % VMPB_ALIGNMENT;
+	fwrite(zeros, 1, padding, binary_file);
+	return written + padding;
+}
+
+/* vmpb_is_binary: checks if a mapped instance file is a binary instance file
+ * parameter: mapping of the file
+ * parameter: bytes of the mapping
+ * returns: 1 if the file starts with VMPB_MAGIC, 0 otherwise
+ */
+int vmpb_is_binary(const void *mapping, size_t mapping_size)
+{
+	return mapping_size >= sizeof (struct vmpb_header) && memcmp(mapping, VMPB_MAGIC, 4) == 0;
+}
+
+/* vmpb_write: writes a datacenter instance as a binary instance file, derived tables included
+ * parameter: path to the binary instance file
+ * parameter: datacenter instance
+ * returns: 0 if the file was written, -1 otherwise
+ */
+int vmpb_write(const char *path_to_file, struct datacenter *datacenter)
+{
+	/* iterators */
+	int iterator_row;
+	int iterator_table;
+	struct vmpb_header header;
+	/* tables in the order of the file, H and V are written row by row */
+	const void *tables[VMPB_TABLES];
+	unsigned long long written;
+	FILE *binary_file;
+	int failed;
+	memset(&header, 0, sizeof (struct vmpb_header));
+	memcpy(header.magic, VMPB_MAGIC, 4);
+	header.version = VMPB_VERSION;
+	header.byte_order = VMPB_BYTE_ORDER;
+	header.h_size = datacenter->h_size;
+	header.v_size = datacenter->v_size;
+	header.l_size = datacenter->l_size;
+	header.number_of_pairs = datacenter->T->number_of_pairs;
+	header.number_of_links = datacenter->topology->link_start[datacenter->h_size];
+	header.number_of_shared = datacenter->topology->shared_start[datacenter->h_size];
+	table_sizes(&header);
+	written = sizeof (struct vmpb_header);
+	for (iterator_table = 0; iterator_table < VMPB_TABLES; iterator_table++)
+	{
+		written += (VMPB_ALIGNMENT - written % VMPB_ALIGNMENT) % VMPB_ALIGNMENT;
+		header.offset[iterator_table] = written;
+		written += header.size[iterator_table];
+	}
+	tables[VMPB_PHYSICAL] = NULL;
+	tables[VMPB_VIRTUAL] = NULL;
+	tables[VMPB_ROW_START] = datacenter->T->row_start;
+	tables[VMPB_COLUMN] = datacenter->T->column;
+	tables[VMPB_VALUE] = datacenter->T->value;
+	tables[VMPB_COLUMN_START] = datacenter->T->column_start;
+	tables[VMPB_ROW] = datacenter->T->row;
+	tables[VMPB_COLUMN_VALUE] = datacenter->T->column_value;
+	tables[VMPB_LINK_START] = datacenter->topology->link_start;
+	tables[VMPB_LINK] = datacenter->topology->link;
+	tables[VMPB_SHARED_START] = datacenter->topology->shared_start;
+	tables[VMPB_SHARED_PHYSICAL] = datacenter->topology->shared_physical;
+	tables[VMPB_K] = datacenter->K;
+	tables[VMPB_QOS] = datacenter->qos;
+	tables[VMPB_POWER_IDLE] = datacenter->power_idle;
+	tables[VMPB_POWER_DYNAMIC] = datacenter->power_dynamic;
+	binary_file = fopen(path_to_file, "wb");
+	if (binary_file == NULL)
+	{
+		printf("[ERROR] can not open the binary instance file %s\n", path_to_file);
+		return -1;
+	}
+	fwrite(&header, sizeof (struct vmpb_header), 1, binary_file);
+	written = sizeof (struct vmpb_header);
+	for (iterator_table = 0; iterator_table < VMPB_TABLES; iterator_table++)
+	{
+		written = write_padding(binary_file, written);
+		if (iterator_table == VMPB_PHYSICAL)
+		{
+			for (iterator_row = 0; iterator_row < datacenter->h_size; iterator_row++)
+			{
+				fwrite(datacenter->H[iterator_row], sizeof (int), 4, binary_file);
+			}
+		}
+		else if (iterator_table == VMPB_VIRTUAL)
+		{
+			for (iterator_row = 0; iterator_row < datacenter->v_size; iterator_row++)
+			{
+				fwrite(datacenter->V[iterator_row], sizeof (int), 5, binary_file);
+			}
+		}
+		else
+		{
+			fwrite(tables[iterator_table], 1, header.size[iterator_table], binary_file);
+		}
+		written += header.size[iterator_table];
+	}
+	failed = ferror(binary_file);
+	if (fclose(binary_file) != 0 || failed)
+	{
+		printf("[ERROR] can not write the binary instance file %s\n", path_to_file);
+		return -1;
+	}
+	return 0;
+}
+
+/* check_index: checks a compressed index of a binary instance file: its starts grow from 0 to the number of
+ * entries, and every entry is an identificator below the limit
+ * parameter: starts of the rows, number_of_rows + 1 of them
+ * parameter: number of rows
+ * parameter: entries
+ * parameter: number of entries
+ * parameter: limit of the identificators of the entries
+ * returns: 0 if the index is valid, -1 otherwise
+ */
+static int check_index(const int *start, int number_of_rows, const int *entry, int number_of_entries, int limit)
+{
+	/* iterators */
+	int iterator_row;
+	int iterator_entry;
+	if (start[0] != 0 || start[number_of_rows] != number_of_entries)
+	{
+		return -1;
+	}
+	for (iterator_row = 0; iterator_row < number_of_rows; iterator_row++)
+	{
+		if (start[iterator_row + 1] < start[iterator_row])
+		{
+			return -1;
+		}
+	}
+	for (iterator_entry = 0; iterator_entry < number_of_entries; iterator_entry++)
+	{
+		if (entry[iterator_entry] < 0 || entry[iterator_entry] >= limit)
+		{
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/* check_tables: checks that the indices of the tables of a binary instance file stay in the instance, so a corrupted
+ * file can not lead the stages out of their arrays
+ * parameter: header of the binary instance file, with the sizes checked
+ * parameter: start of the mapping
+ * returns: the first table that is not valid, -1 if all of them are
+ */
+static int check_tables(const struct vmpb_header *header, const char *base)
+{
+	/* iterator */
+	int iterator_pair;
+	const traffic_t *value = (const traffic_t *) (base + header->offset[VMPB_VALUE]);
+	const traffic_t *column_value = (const traffic_t *) (base + header->offset[VMPB_COLUMN_VALUE]);
+	if (check_index((const int *) (base + header->offset[VMPB_ROW_START]), header->v_size, (const int *) (base + header->offset[VMPB_COLUMN]),
+		header->number_of_pairs, header->v_size) != 0)
+	{
+		return VMPB_COLUMN;
+	}
+	if (check_index((const int *) (base + header->offset[VMPB_COLUMN_START]), header->v_size, (const int *) (base + header->offset[VMPB_ROW]),
+		header->number_of_pairs, header->v_size) != 0)
+	{
+		return VMPB_ROW;
+	}
+	for (iterator_pair = 0; iterator_pair < header->number_of_pairs; iterator_pair++)
+	{
+		if (value[iterator_pair] > MAX_TRAFFIC || column_value[iterator_pair] > MAX_TRAFFIC)
+		{
+			return VMPB_VALUE;
+		}
+	}
+	if (check_index((const int *) (base + header->offset[VMPB_LINK_START]), header->h_size, (const int *) (base + header->offset[VMPB_LINK]),
+		header->number_of_links, header->l_size) != 0)
+	{
+		return VMPB_LINK;
+	}
+	if (check_index((const int *) (base + header->offset[VMPB_SHARED_START]), header->h_size,
+		(const int *) (base + header->offset[VMPB_SHARED_PHYSICAL]), header->number_of_shared, header->h_size) != 0)
+	{
+		return VMPB_SHARED_PHYSICAL;
+	}
+	return -1;
+}
+
+/* vmpb_attach: fills a datacenter instance with the tables of a mapped binary instance file, nothing is parsed
+ * or copied, only the row pointers of H and V are allocated. The mapping belongs to the instance from here on
+ * parameter: path to the binary instance file, for the errors
+ * parameter: read only mapping of the file
+ * parameter: bytes of the mapping
+ * parameter: datacenter instance to fill
+ * returns: 0 if the header and the indices are valid, -1 otherwise, the mapping is released on errors
+ */
+int vmpb_attach(const char *path_to_file, void *mapping, size_t mapping_size, struct datacenter *datacenter)
+{
+	/* iterators */
+	int iterator_row;
+	int iterator_table;
+	struct vmpb_header header;
+	struct vmpb_header expected;
+	char *base = (char *) mapping;
+	memcpy(&header, mapping, sizeof (struct vmpb_header));
+	if (header.byte_order != VMPB_BYTE_ORDER)
+	{
+		printf("[ERROR] %s: binary instance file of a machine with another byte order\n", path_to_file);
+		munmap(mapping, mapping_size);
+		return -1;
+	}
+	if (header.version != VMPB_VERSION)
+	{
+		printf("[ERROR] %s: binary instance file version %u, expected %d, convert the .vmp file again\n",
+			path_to_file, header.version, VMPB_VERSION);
+		munmap(mapping, mapping_size);
+		return -1;
+	}
+	if (header.h_size <= 0 || header.v_size < 0 || header.l_size < 0 ||
+		header.number_of_pairs < 0 || header.number_of_links < 0 || header.number_of_shared < 0)
+	{
+		printf("[ERROR] %s: corrupted binary instance file header\n", path_to_file);
+		munmap(mapping, mapping_size);
+		return -1;
+	}
+	/* the sizes of the tables follow from the sizes of the instance, so a truncated file is caught here */
+	memcpy(&expected, &header, sizeof (struct vmpb_header));
+	table_sizes(&expected);
+	for (iterator_table = 0; iterator_table < VMPB_TABLES; iterator_table++)
+	{
+		if (header.size[iterator_table] != expected.size[iterator_table] || header.offset[iterator_table] % VMPB_ALIGNMENT != 0 ||
+			header.offset[iterator_table] > mapping_size || header.size[iterator_table] > mapping_size - header.offset[iterator_table])
+		{
+			printf("[ERROR] %s: table %d of the binary instance file is corrupted or truncated\n", path_to_file, iterator_table);
+			munmap(mapping, mapping_size);
+			return -1;
+		}
+	}
+	iterator_table = check_tables(&header, base);
+	if (iterator_table >= 0)
+	{
+		printf("[ERROR] %s: table %d of the binary instance file is out of the instance\n", path_to_file, iterator_table);
+		munmap(mapping, mapping_size);
+		return -1;
+	}
+	datacenter->h_size = header.h_size;
+	datacenter->v_size = header.v_size;
+	datacenter->l_size = header.l_size;
+	datacenter->H = (int **) malloc ((header.h_size + 1) * sizeof (int *));
+	datacenter->V = (int **) malloc ((header.v_size + 1) * sizeof (int *));
+	for (iterator_row = 0; iterator_row < header.h_size; iterator_row++)
+	{
+		datacenter->H[iterator_row] = (int *) (base + header.offset[VMPB_PHYSICAL]) + iterator_row * 4;
+	}
+	for (iterator_row = 0; iterator_row < header.v_size; iterator_row++)
+	{
+		datacenter->V[iterator_row] = (int *) (base + header.offset[VMPB_VIRTUAL]) + iterator_row * 5;
+	}
+	datacenter->T = (struct traffic_matrix *) malloc (sizeof (struct traffic_matrix));
+	datacenter->T->v_size = header.v_size;
+	datacenter->T->number_of_pairs = header.number_of_pairs;
+	datacenter->T->row_start = (int *) (base + header.offset[VMPB_ROW_START]);
+	datacenter->T->column = (int *) (base + header.offset[VMPB_COLUMN]);
+	datacenter->T->value = (traffic_t *) (base + header.offset[VMPB_VALUE]);
+	datacenter->T->column_start = (int *) (base + header.offset[VMPB_COLUMN_START]);
+	datacenter->T->row = (int *) (base + header.offset[VMPB_ROW]);
+	datacenter->T->column_value = (traffic_t *) (base + header.offset[VMPB_COLUMN_VALUE]);
+	datacenter->topology = (struct network_topology *) malloc (sizeof (struct network_topology));
+	datacenter->topology->h_size = header.h_size;
+	datacenter->topology->l_size = header.l_size;
+	datacenter->topology->link_start = (int *) (base + header.offset[VMPB_LINK_START]);
+	datacenter->topology->link = (int *) (base + header.offset[VMPB_LINK]);
+	datacenter->topology->shared_start = (int *) (base + header.offset[VMPB_SHARED_START]);
+	datacenter->topology->shared_physical = (int *) (base + header.offset[VMPB_SHARED_PHYSICAL]);
+	datacenter->K = (int *) (base + header.offset[VMPB_K]);
+	datacenter->qos = (float *) (base + header.offset[VMPB_QOS]);
+	datacenter->power_idle = (double *) (base + header.offset[VMPB_POWER_IDLE]);
+	datacenter->power_dynamic = (double *) (base + header.offset[VMPB_POWER_DYNAMIC]);
+	datacenter->mapping = mapping;
+	datacenter->mapping_size = mapping_size;
+	return 0;
+}
+
+/* vmpb_detach: releases a datacenter instance attached to a binary instance file
+ * parameter: datacenter instance
+ * returns: nothing, it's void
+ */
+void vmpb_detach(struct datacenter *datacenter)
+{
+	free(datacenter->H);
+	free(datacenter->V);
+	free(datacenter->T);
+	free(datacenter->topology);
+	munmap(datacenter->mapping, datacenter->mapping_size);
+	memset(datacenter, 0, sizeof (struct datacenter));
+}
@@ -0,0 +1,68 @@
+/*
+ * vmpb.h: Virtual Machine Placement Problem - Binary Datacenter Instance Header
+ * Date: 17-10-2026
+ * Corresponding Conference Paper: A Many-Objective Optimization Framework for Virtualized Datacenters
+ */
+
+#ifndef VMPB_H
+#define VMPB_H
+
+/* include libraries */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+/* include own headers */
+#include "datacenter.h"
+/* definitions, the version changes with any change of the layout */
+#define VMPB_MAGIC "VMPB"
+#define VMPB_VERSION 2
+#define VMPB_BYTE_ORDER 0x01020304u
+#define VMPB_ALIGNMENT 64
+/* definitions, the tables of a binary instance file in their order */
+#define VMPB_PHYSICAL 0
+#define VMPB_VIRTUAL 1
+#define VMPB_ROW_START 2
+#define VMPB_COLUMN 3
+#define VMPB_VALUE 4
+#define VMPB_COLUMN_START 5
+#define VMPB_ROW 6
+#define VMPB_COLUMN_VALUE 7
+#define VMPB_LINK_START 8
+#define VMPB_LINK 9
+#define VMPB_SHARED_START 10
+#define VMPB_SHARED_PHYSICAL 11
+#define VMPB_K 12
+#define VMPB_QOS 13
+#define VMPB_POWER_IDLE 14
+#define VMPB_POWER_DYNAMIC 15
+#define VMPB_TABLES 16
+
+/* header at the start of a binary instance file, every table starts at a multiple of VMPB_ALIGNMENT */
+struct vmpb_header
+{
+	char magic[4];
+	unsigned int version;
+	/* VMPB_BYTE_ORDER as written, the tables are in the byte order of the machine that converted the file */
+	unsigned int byte_order;
+	int h_size;
+	int v_size;
+	int l_size;
+	/* pairs of virtual machines with traffic, links of all physical machines and pairs of physical machines sharing a link */
+	int number_of_pairs;
+	int number_of_links;
+	int number_of_shared;
+	int reserved;
+	/* position and bytes of each table in the file */
+	unsigned long long offset[VMPB_TABLES];
+	unsigned long long size[VMPB_TABLES];
+};
+
+/* function headers definitions */
+int vmpb_is_binary(const void *mapping, size_t mapping_size);
+int vmpb_write(const char *path_to_file, struct datacenter *datacenter);
+int vmpb_attach(const char *path_to_file, void *mapping, size_t mapping_size, struct datacenter *datacenter);
+void vmpb_detach(struct datacenter *datacenter);
+
+#endif